@@ -1,15 +1,163 @@
 #pragma once
 
+#include <climits> // CHAR_MIN
+#include <cstring> // memcmp, memmove, memset
+#include <utility> // move
+
+#include "type_traits.hpp"
+#include "iterators/RandomAccessIterator.hpp"
+
 namespace ft {
 
+// ************************************************************************** //
+//                              contiguous ranges                             //
+// ************************************************************************** //
+
+/*
+**	Iterators over contiguous storage are unwrapped back into pointers so the
+**	algorithms can hand whole ranges to the C library. Every other iterator is
+**	returned as is.
+*/
+
+template <typename Iterator>
+Iterator	_unwrap( Iterator it ) { return it; }
+
+template <typename T>
+T *	_unwrap( RandomAccessIterator<T> it ) { return it.base(); }
+
+// Turns the pointer an algorithm returned back into the caller's iterator type
+template <typename Iterator>
+Iterator	_rewrap( Iterator, Iterator result ) { return result; }
+
+template <typename T>
+RandomAccessIterator<T>	_rewrap( RandomAccessIterator<T>, T * result ) { return RandomAccessIterator<T>(result); }
+
+/*
+**	Ranges of T and U are equal exactly when their bytes are: the same integral
+**	or pointer type. Floating point types are left out (0.0 == -0.0, NaN).
+*/
+template <typename T, typename U>
+struct _is_bitwise_comparable : integral_constant<bool,
+	is_same<typename remove_const<T>::type, typename remove_const<U>::type>::value
+	&& (is_integral<typename remove_const<T>::type>::value || is_pointer<typename remove_const<T>::type>::value)
+> { /* no-op */ };
+
+// Single byte types whose operator< agrees with memcmp
+template <typename T>
+struct _is_unsigned_byte : false_type { /* no-op */ };
+
+template <typename T>
+struct _is_unsigned_byte<const T> : _is_unsigned_byte<T> { /* no-op */ };
+
+template <>
+struct _is_unsigned_byte<unsigned char> : true_type { /* no-op */ };
+
+template <>
+struct _is_unsigned_byte<char> : integral_constant<bool, CHAR_MIN == 0> { /* no-op */ };
+
 template <typename Iterator1, typename Iterator2>
-bool	equal( Iterator1 first1, Iterator1 last1, Iterator2 first2 ) {
+false_type	_bitwise_comparable( Iterator1, Iterator2 ) { return false_type(); }
+
+template <typename T, typename U>
+integral_constant<bool, _is_bitwise_comparable<T, U>::value>	_bitwise_comparable( T *, U * ) {
+	return integral_constant<bool, _is_bitwise_comparable<T, U>::value>();
+}
+
+/*
+**	A range of T can be copied into a range of U with memmove: the same scalar
+**	type, U being writable.
+*/
+template <typename T, typename U>
+struct _is_bitwise_copyable : integral_constant<bool,
+	is_same<typename remove_const<T>::type, U>::value && is_scalar<U>::value
+> { /* no-op */ };
+
+template <typename Iterator1, typename Iterator2>
+false_type	_bitwise_copyable( Iterator1, Iterator2 ) { return false_type(); }
+
+template <typename T, typename U>
+integral_constant<bool, _is_bitwise_copyable<T, U>::value>	_bitwise_copyable( T *, U * ) {
+	return integral_constant<bool, _is_bitwise_copyable<T, U>::value>();
+}
+
+// Every byte of val is the same, so a fill can be a memset
+template <typename T>
+bool	_is_byte_pattern( const T & val ) {
+	const unsigned char *	bytes = reinterpret_cast<const unsigned char *>(&val);
+
+	for (size_t i = 1; i < sizeof(T); i++) {
+		if (bytes[i] != bytes[0]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Index of the first difference between a and b, memcmp'ing blocks to get to it
+template <typename T, typename U>
+size_t	_mismatch_index( const T * a, const U * b, size_t n ) {
+	const size_t	block = 256 / sizeof(T) ? 256 / sizeof(T) : 1;
+	size_t			i = 0;
+
+	while (i + block <= n && !std::memcmp(a + i, b + i, block * sizeof(T))) {
+		i += block;
+	}
+	while (i < n && a[i] == b[i]) {
+		i++;
+	}
+	return i;
+}
+
+// operator<, the default ordering of the sorting and searching algorithms
+struct _iter_less {
+	template <typename T, typename U>
+	bool	operator () ( const T & a, const U & b ) const { return a < b; }
+};
+
+struct _iter_equal {
+	template <typename T, typename U>
+	bool	operator () ( const T & a, const U & b ) const { return a == b; }
+};
+
+// Predicate matching the elements equal to val
+template <typename T>
+struct _equal_to_value {
+	const T &	val;
+
+	explicit _equal_to_value( const T & val ) : val(val) { /* no-op */ }
+
+	template <typename U>
+	bool	operator () ( const U & x ) const { return x == val; }
+};
+
+
+// ************************************************************************** //
+//                                   equal                                    //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/algorithm/equal
+*/
+
+template <typename Iterator1, typename Iterator2>
+bool	_equal( Iterator1 first1, Iterator1 last1, Iterator2 first2, false_type ) {
 	for (; first1 != last1; ++first1, ++first2) {
 		if (!(*first1 == *first2)) {
 			return false;
 		}
 	}
 	return true;
+} // element wise
+
+template <typename T, typename U>
+bool	_equal( T * first1, T * last1, U * first2, true_type ) {
+	return first1 == last1 || !std::memcmp(first1, first2, (last1 - first1) * sizeof(T));
+} // memcmp
+
+template <typename Iterator1, typename Iterator2>
+bool	equal( Iterator1 first1, Iterator1 last1, Iterator2 first2 ) {
+	return _equal(_unwrap(first1), _unwrap(last1), _unwrap(first2),
+		_bitwise_comparable(_unwrap(first1), _unwrap(first2)));
 }
 
 template <typename Iterator1, typename Iterator2, typename BinaryPredicate>
@@ -22,9 +170,18 @@ bool	equal( Iterator1 first1, Iterator1 last1, Iterator2 first2, BinaryPredicate
 	return true;
 }
 
+
+// ************************************************************************** //
+//                          lexicographical_compare                           //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/algorithm/lexicographical_compare
+*/
+
 template <typename Iterator1, typename Iterator2>
-bool	lexicographical_compare( Iterator1 first1, Iterator1 last1,
-                                 Iterator2 first2, Iterator2 last2 ) {
+bool	_lexicographical_compare( Iterator1 first1, Iterator1 last1,
+								  Iterator2 first2, Iterator2 last2, false_type ) {
 	for (; first1 != last1; ++first1, ++first2) {
 		if (first2 == last2 || *first2 < *first1) {
 			return false;
@@ -34,6 +191,35 @@ bool	lexicographical_compare( Iterator1 first1, Iterator1 last1,
 		}
 	}
 	return (first2 != last2);
+} // element wise
+
+template <typename T, typename U>
+bool	_lexicographical_compare( T * first1, T * last1, U * first2, U * last2, true_type ) {
+	size_t	n1 = last1 - first1;
+	size_t	n2 = last2 - first2;
+	size_t	n = n1 < n2 ? n1 : n2;
+
+	if (_is_unsigned_byte<T>::value) {
+		int	diff = n ? std::memcmp(first1, first2, n) : 0;
+
+		if (diff) {
+			return diff < 0;
+		}
+	} else {
+		size_t	i = _mismatch_index(first1, first2, n);
+
+		if (i < n) {
+			return first1[i] < first2[i];
+		}
+	}
+	return n1 < n2;
+} // memcmp up to the first difference
+
+template <typename Iterator1, typename Iterator2>
+bool	lexicographical_compare( Iterator1 first1, Iterator1 last1,
+                                 Iterator2 first2, Iterator2 last2 ) {
+	return _lexicographical_compare(_unwrap(first1), _unwrap(last1), _unwrap(first2), _unwrap(last2),
+		_bitwise_comparable(_unwrap(first1), _unwrap(first2)));
 }
 
 template <typename Iterator1, typename Iterator2, typename Compare>
@@ -51,4 +237,299 @@ bool	lexicographical_compare( Iterator1 first1, Iterator1 last1,
 	return (first2 != last2);
 }
 
+
+// ************************************************************************** //
+//                            copy / copy_backward                            //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/algorithm/copy
+**	https://en.cppreference.com/w/cpp/algorithm/copy_backward
+**
+**	Contiguous ranges of the same scalar type are moved with a single memmove,
+**	so overlapping ranges are fine in the direction each algorithm allows.
+*/
+
+template <typename InputIterator, typename OutputIterator>
+OutputIterator	_copy( InputIterator first, InputIterator last, OutputIterator dest, false_type ) {
+	for (; first != last; ++first, ++dest) {
+		*dest = *first;
+	}
+	return dest;
+} // element wise
+
+template <typename T, typename U>
+U *	_copy( T * first, T * last, U * dest, true_type ) {
+	if (first != last) {
+		std::memmove(static_cast<void *>(dest), static_cast<const void *>(first), (last - first) * sizeof(T));
+	}
+	return dest + (last - first);
+} // memmove
+
+template <typename InputIterator, typename OutputIterator>
+OutputIterator	copy( InputIterator first, InputIterator last, OutputIterator dest ) {
+	return _rewrap(dest, _copy(_unwrap(first), _unwrap(last), _unwrap(dest),
+		_bitwise_copyable(_unwrap(first), _unwrap(dest))));
+}
+
+template <typename BidirectionalIterator1, typename BidirectionalIterator2>
+BidirectionalIterator2	_copy_backward( BidirectionalIterator1 first, BidirectionalIterator1 last,
+										BidirectionalIterator2 dest, false_type ) {
+	while (first != last) {
+		*--dest = *--last;
+	}
+	return dest;
+} // element wise
+
+template <typename T, typename U>
+U *	_copy_backward( T * first, T * last, U * dest, true_type ) {
+	return _copy(first, last, dest - (last - first), true_type()) - (last - first);
+} // memmove
+
+template <typename BidirectionalIterator1, typename BidirectionalIterator2>
+BidirectionalIterator2	copy_backward( BidirectionalIterator1 first, BidirectionalIterator1 last,
+									   BidirectionalIterator2 dest ) {
+	return _rewrap(dest, _copy_backward(_unwrap(first), _unwrap(last), _unwrap(dest),
+		_bitwise_copyable(_unwrap(first), _unwrap(dest))));
+}
+
+
+// ************************************************************************** //
+//                            move / move_backward                            //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/algorithm/move
+**	https://en.cppreference.com/w/cpp/algorithm/move_backward
+**
+**	Move assigns from C++11 on, copies before that.
+*/
+
+template <typename InputIterator, typename OutputIterator>
+OutputIterator	_move( InputIterator first, InputIterator last, OutputIterator dest, false_type ) {
+	for (; first != last; ++first, ++dest) {
+#if __cplusplus >= 201103L
+		*dest = std::move(*first);
+#else
+		*dest = *first;
+#endif
+	}
+	return dest;
+} // element wise
+
+template <typename T, typename U>
+U *	_move( T * first, T * last, U * dest, true_type ) { return _copy(first, last, dest, true_type()); }
+
+template <typename InputIterator, typename OutputIterator>
+OutputIterator	move( InputIterator first, InputIterator last, OutputIterator dest ) {
+	return _rewrap(dest, _move(_unwrap(first), _unwrap(last), _unwrap(dest),
+		_bitwise_copyable(_unwrap(first), _unwrap(dest))));
+}
+
+template <typename BidirectionalIterator1, typename BidirectionalIterator2>
+BidirectionalIterator2	_move_backward( BidirectionalIterator1 first, BidirectionalIterator1 last,
+										BidirectionalIterator2 dest, false_type ) {
+	while (first != last) {
+#if __cplusplus >= 201103L
+		*--dest = std::move(*--last);
+#else
+		*--dest = *--last;
+#endif
+	}
+	return dest;
+} // element wise
+
+template <typename T, typename U>
+U *	_move_backward( T * first, T * last, U * dest, true_type ) {
+	return _copy_backward(first, last, dest, true_type());
+}
+
+template <typename BidirectionalIterator1, typename BidirectionalIterator2>
+BidirectionalIterator2	move_backward( BidirectionalIterator1 first, BidirectionalIterator1 last,
+									   BidirectionalIterator2 dest ) {
+	return _rewrap(dest, _move_backward(_unwrap(first), _unwrap(last), _unwrap(dest),
+		_bitwise_copyable(_unwrap(first), _unwrap(dest))));
+}
+
+
+// ************************************************************************** //
+//                                fill / fill_n                               //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/algorithm/fill
+**	https://en.cppreference.com/w/cpp/algorithm/fill_n
+**
+**	Contiguous scalars are memset when every byte of the value is the same,
+**	and written in a plain loop the compiler can vectorize otherwise.
+*/
+
+template <typename ForwardIterator, typename T>
+void	_fill( ForwardIterator first, ForwardIterator last, const T & val, false_type ) {
+	for (; first != last; ++first) {
+		*first = val;
+	}
+} // element wise
+
+template <typename T, typename U>
+void	_fill( T * first, T * last, const U & val, true_type ) {
+	const T	tmp = val;
+
+	if (_is_byte_pattern(tmp)) {
+		std::memset(static_cast<void *>(first), *reinterpret_cast<const unsigned char *>(&tmp), (last - first) * sizeof(T));
+		return ;
+	}
+	for (; first != last; ++first) {
+		*first = tmp;
+	}
+} // scalar
+
+template <typename ForwardIterator>
+false_type	_fillable( ForwardIterator ) { return false_type(); }
+
+template <typename T>
+integral_constant<bool, is_scalar<T>::value>	_fillable( T * ) { return integral_constant<bool, is_scalar<T>::value>(); }
+
+template <typename ForwardIterator, typename T>
+void	fill( ForwardIterator first, ForwardIterator last, const T & val ) {
+	_fill(_unwrap(first), _unwrap(last), val, _fillable(_unwrap(first)));
+}
+
+template <typename OutputIterator, typename Size, typename T>
+OutputIterator	_fill_n( OutputIterator first, Size n, const T & val, false_type ) {
+	for (; n > 0; --n, ++first) {
+		*first = val;
+	}
+	return first;
+} // element wise
+
+template <typename T, typename Size, typename U>
+T *	_fill_n( T * first, Size n, const U & val, true_type ) {
+	if (n <= 0) {
+		return first;
+	}
+	_fill(first, first + n, val, true_type());
+	return first + n;
+} // scalar
+
+template <typename OutputIterator, typename Size, typename T>
+OutputIterator	fill_n( OutputIterator first, Size n, const T & val ) {
+	return _rewrap(first, _fill_n(_unwrap(first), n, val, _fillable(_unwrap(first))));
+}
+
+
+// ************************************************************************** //
+//                         remove / remove_if / unique                        //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/algorithm/remove
+**	https://en.cppreference.com/w/cpp/algorithm/unique
+**
+**	One pass: each kept element is moved once, straight to its final slot,
+**	and the returned iterator is the new end. What lies past it is left in a
+**	valid but unspecified state for the caller to erase in one go.
+*/
+
+template <typename ForwardIterator, typename Predicate>
+ForwardIterator	_remove_if( ForwardIterator first, ForwardIterator last, Predicate pred ) {
+	while (first != last && !pred(*first)) {
+		++first;
+	}
+	if (first == last) {
+		return first;
+	}
+	ForwardIterator	dest = first;
+
+	while (++first != last) {
+		if (!pred(*first)) {
+#if __cplusplus >= 201103L
+			*dest = std::move(*first);
+#else
+			*dest = *first;
+#endif
+			++dest;
+		}
+	}
+	return dest;
+}
+
+template <typename ForwardIterator, typename Predicate>
+ForwardIterator	remove_if( ForwardIterator first, ForwardIterator last, Predicate pred ) {
+	return _rewrap(first, _remove_if(_unwrap(first), _unwrap(last), pred));
+}
+
+template <typename ForwardIterator, typename T>
+ForwardIterator	remove( ForwardIterator first, ForwardIterator last, const T & val ) {
+	return ft::remove_if(first, last, _equal_to_value<T>(val));
+}
+
+template <typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator	_unique( ForwardIterator first, ForwardIterator last, BinaryPredicate pred ) {
+	if (first == last) {
+		return last;
+	}
+	ForwardIterator	dest = first;
+
+	while (++first != last) {
+		if (!pred(*dest, *first) && ++dest != first) {
+#if __cplusplus >= 201103L
+			*dest = std::move(*first);
+#else
+			*dest = *first;
+#endif
+		}
+	}
+	return ++dest;
+}
+
+template <typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator	unique( ForwardIterator first, ForwardIterator last, BinaryPredicate pred ) {
+	return _rewrap(first, _unique(_unwrap(first), _unwrap(last), pred));
+}
+
+template <typename ForwardIterator>
+ForwardIterator	unique( ForwardIterator first, ForwardIterator last ) {
+	return ft::unique(first, last, _iter_equal());
+}
+
+
+// ************************************************************************** //
+//                         reverse_iterator unwrapping                        //
+// ************************************************************************** //
+
+/*
+**	Reversed ranges are the underlying ranges walked the other way, so they
+**	reach the fast paths above through their base().
+*/
+
+template <typename Iterator1, typename Iterator2>
+reverse_iterator<Iterator2>	copy( reverse_iterator<Iterator1> first, reverse_iterator<Iterator1> last,
+								  reverse_iterator<Iterator2> dest ) {
+	return reverse_iterator<Iterator2>(ft::copy_backward(last.base(), first.base(), dest.base()));
+}
+
+template <typename Iterator1, typename Iterator2>
+reverse_iterator<Iterator2>	copy_backward( reverse_iterator<Iterator1> first, reverse_iterator<Iterator1> last,
+										   reverse_iterator<Iterator2> dest ) {
+	return reverse_iterator<Iterator2>(ft::copy(last.base(), first.base(), dest.base()));
+}
+
+template <typename Iterator1, typename Iterator2>
+reverse_iterator<Iterator2>	move( reverse_iterator<Iterator1> first, reverse_iterator<Iterator1> last,
+								  reverse_iterator<Iterator2> dest ) {
+	return reverse_iterator<Iterator2>(ft::move_backward(last.base(), first.base(), dest.base()));
+}
+
+template <typename Iterator1, typename Iterator2>
+reverse_iterator<Iterator2>	move_backward( reverse_iterator<Iterator1> first, reverse_iterator<Iterator1> last,
+										   reverse_iterator<Iterator2> dest ) {
+	return reverse_iterator<Iterator2>(ft::move(last.base(), first.base(), dest.base()));
+}
+
+template <typename Iterator, typename T>
+void	fill( reverse_iterator<Iterator> first, reverse_iterator<Iterator> last, const T & val ) {
+	ft::fill(last.base(), first.base(), val);
+}
+
 }
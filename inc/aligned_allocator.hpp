@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdlib> // posix_memalign, free
+#include <cstddef> // ptrdiff_t
+#include <new> // bad_alloc, placement new
+
+#include "memory.hpp"
+
+namespace ft {
+
+// ************************************************************************** //
+//                          aligned_allocator template                        //
+// ************************************************************************** //
+
+/*
+**	Allocates blocks aligned on Alignment bytes (a power of two, at least the
+**	size of a pointer) with posix_memalign: 32 for AVX2, 64 for AVX-512 and
+**	cache lines.
+**
+**	Containers read the alignment through allocator_alignment. ft::vector pads
+**	its capacity so the buffer ends on an Alignment boundary too, and
+**	aligned_data() tells the compiler about the alignment.
+*/
+
+template <typename T, size_t Alignment = 64>
+class aligned_allocator {
+
+	// Fails to compile for alignments posix_memalign refuses
+	typedef char	_alignment_check[(Alignment & (Alignment - 1)) == 0 && Alignment >= sizeof(void *) ? 1 : -1];
+
+public:
+	/* Member types */
+	typedef T				value_type;
+	typedef T *				pointer;
+	typedef const T *		const_pointer;
+	typedef T &				reference;
+	typedef const T &		const_reference;
+	typedef size_t			size_type;
+	typedef ptrdiff_t		difference_type;
+
+	static const size_t		alignment = Alignment;
+
+	template <typename U>
+	struct rebind { typedef aligned_allocator<U, Alignment> other; };
+
+	/* Constructors */
+	aligned_allocator( void ) { /* no-op */ }
+	aligned_allocator( const aligned_allocator & ) { /* no-op */ }
+	template <typename U>
+	aligned_allocator( const aligned_allocator<U, Alignment> & ) { /* no-op */ }
+	~aligned_allocator( void ) { /* no-op */ }
+
+	pointer			address( reference x ) const { return &x; }
+	const_pointer	address( const_reference x ) const { return &x; }
+	size_type		max_size( void ) const { return static_cast<size_type>(-1) / sizeof(T); }
+
+	pointer	allocate( size_type n, const void * hint = 0 ) {
+		void *	p = NULL;
+
+		(void)hint;
+		if (n > max_size() || ::posix_memalign(&p, Alignment, n * sizeof(T))) {
+			throw std::bad_alloc();
+		}
+		return static_cast<pointer>(p);
+	}
+
+	void	deallocate( pointer p, size_type ) { std::free(p); }
+
+	void	construct( pointer p, const_reference val ) { new (static_cast<void *>(p)) T(val); }
+	void	destroy( pointer p ) { p->~T(); }
+
+};
+
+/* Non-member functions */
+
+template <typename T, typename U, size_t Alignment>
+bool	operator == ( const aligned_allocator<T, Alignment> &, const aligned_allocator<U, Alignment> & ) { return true; }
+
+template <typename T, typename U, size_t Alignment>
+bool	operator != ( const aligned_allocator<T, Alignment> &, const aligned_allocator<U, Alignment> & ) { return false; }
+
+template <typename T, size_t Alignment>
+struct allocator_alignment< aligned_allocator<T, Alignment> > : integral_constant<size_t, Alignment> {};
+
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "benchmarks/benchmark.hpp"
+
+#if defined(STL)
+	# include <algorithm>
+	# include <numeric>
+	# include <set>
+	# include <vector>
+	namespace ft = std;
+#else
+	# include "sort.hpp"
+	# include "parallel.hpp"
+	# include "search.hpp"
+	# include "set.hpp"
+	# include "vector.hpp"
+#endif
+
+void	algorithm_benchmarks( void );
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <sys/time.h>
+#include <cstdlib>
+#include <iomanip>
+#include <memory>
+
+#include "macros.hpp"
+#include "convert.hpp"
+
+#if defined(STL)
+	# define BENCH_TARGET "std"
+#else
+	# define BENCH_TARGET "ft"
+#endif
+
+#define BENCH_MAX_MB 64 // default for the BENCH_MAX_MB environment variable
+#define BENCH_WIDTH 48
+#define BENCH(name, ms) LOG(std::setw(BENCH_WIDTH) << std::left << (name) \
+	<< std::right << std::setw(12) << std::fixed << std::setprecision(3) << (ms) << " ms")
+#define BENCH_COUNT(name, count) LOG(std::setw(BENCH_WIDTH) << std::left << (name) \
+	<< std::right << std::setw(12) << (count))
+
+// ************************************************************************** //
+//                                 Timer                                      //
+// ************************************************************************** //
+
+class Timer {
+
+public:
+	Timer( void ) { reset(); }
+	~Timer( void ) { /* no-op */ }
+
+	void	reset( void ) { gettimeofday(&_start, NULL); }
+
+	double	elapsed( void ) const {
+		struct timeval	now;
+
+		gettimeofday(&now, NULL);
+		return (now.tv_sec - _start.tv_sec) * 1000.0 + (now.tv_usec - _start.tv_usec) / 1000.0;
+	} // milliseconds
+
+private:
+	struct timeval	_start;
+
+};
+
+/*
+**	Results are folded into a volatile sink so the optimizer can't drop the
+**	measured work.
+*/
+extern volatile size_t	bench_sink;
+
+template <typename T>
+void	consume( const T & value ) { bench_sink += static_cast<size_t>(value); }
+
+/*
+**	The largest working set a benchmark may allocate, in bytes. Set
+**	BENCH_MAX_MB in the environment for larger inputs.
+*/
+inline size_t	bench_max_bytes( void ) {
+	const char *	env = std::getenv("BENCH_MAX_MB");
+	long			mb = env ? std::atol(env) : 0;
+
+	return static_cast<size_t>(mb > 0 ? mb : BENCH_MAX_MB) << 20;
+}
+
+// ************************************************************************** //
+//                           counting_allocator                               //
+// ************************************************************************** //
+
+/*
+**	std::allocator that counts its calls to allocate, for every T.
+*/
+extern size_t	bench_allocations;
+
+template <typename T>
+class counting_allocator : public std::allocator<T> {
+
+public:
+	template <typename U>
+	struct rebind { typedef counting_allocator<U> other; };
+
+	counting_allocator( void ) { /* no-op */ }
+	counting_allocator( const counting_allocator & src ) : std::allocator<T>(src) { /* no-op */ }
+	template <typename U>
+	counting_allocator( const counting_allocator<U> & src ) : std::allocator<T>(src) { /* no-op */ }
+	~counting_allocator( void ) { /* no-op */ }
+
+	T *	allocate( size_t n, const void * hint = 0 ) {
+		bench_allocations++;
+		(void)hint;
+		return std::allocator<T>::allocate(n);
+	}
+
+};
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "benchmarks/benchmark.hpp"
+
+#if defined(STL)
+	# include <map>
+	# include <utility>
+	namespace ft = std;
+#else
+	# include "map.hpp"
+	# include "pool_allocator.hpp"
+#endif
+
+void	map_benchmarks( void );
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "benchmarks/benchmark.hpp"
+
+#if defined(STL)
+	# include <deque>
+	# include <stack>
+	# include <vector>
+	namespace ft = std;
+#else
+	# include "stack.hpp"
+	# include "deque.hpp"
+	# include "vector.hpp"
+#endif
+
+void	stack_benchmarks( void );
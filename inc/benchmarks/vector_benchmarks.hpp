@@ -0,0 +1,20 @@
+#pragma once
+
+#include "benchmarks/benchmark.hpp"
+
+#if defined(STL)
+	# include <algorithm>
+	# include <utility>
+	# include <vector>
+	namespace ft = std;
+#else
+	# include "vector.hpp"
+	# include "small_vector.hpp"
+	# include "soa_vector.hpp"
+	# include "sort.hpp"
+	# include "mapped_vector.hpp"
+	# include "mmap_allocator.hpp"
+	# include "aligned_allocator.hpp"
+#endif
+
+void	vector_benchmarks( void );
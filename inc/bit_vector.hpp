@@ -0,0 +1,466 @@
+#pragma once
+
+#include <cstring> // memcpy
+#include <memory>
+#include <stdexcept>
+
+#include "iterators/BitIterator.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "algorithm.hpp"
+#include "growth.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+// ************************************************************************** //
+//                             vector<bool> template                          //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/container/vector_bool
+**
+**	One bit per element, packed in the words of an ft::vector<_bit_word>. The
+**	bits past size() in the last word are always 0, which lets count(), the
+**	find_ functions, == and the bitwise operators work a word at a time.
+**
+**	Elements are accessed through proxies (BitReference): they convert to
+**	bool and write the bit when assigned. words() gives the storage, bit i
+**	being bit i % _bit_word_size of word i / _bit_word_size.
+*/
+
+template <typename Allocator, typename GrowthPolicy>
+class vector<bool, Allocator, GrowthPolicy> {
+
+public:
+	/* Member types */
+	typedef bool														value_type;
+	typedef Allocator													allocator_type;
+	typedef GrowthPolicy												growth_policy;
+	typedef _bit_word													word_type;
+	typedef typename allocator_type::template rebind<word_type>::other	word_allocator_type;
+	typedef BitReference												reference;
+	typedef bool														const_reference;
+	typedef BitIterator<bool>											iterator;
+	typedef BitIterator<const bool>										const_iterator;
+	typedef typename iterator::pointer									pointer;
+	typedef typename const_iterator::pointer							const_pointer;
+	typedef ft::reverse_iterator<iterator>								reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>						const_reverse_iterator;
+	typedef typename iterator_traits<iterator>::difference_type			difference_type;
+	typedef size_t														size_type;
+
+	// What the find_ functions return when there is no set bit left
+	static const size_type	npos = static_cast<size_type>(-1);
+
+private:
+	typedef ft::vector<word_type, word_allocator_type, GrowthPolicy>	word_vector;
+
+	/* Member variables */
+	word_vector	_words;
+	size_type	_size;
+
+public:
+	/* Constructors */
+	explicit vector( const allocator_type & alloc = allocator_type() )
+		: _words(word_allocator_type(alloc)), _size(0) { /* no-op */ } // default
+
+	explicit vector( size_type n,
+					 const value_type & val = value_type(),
+					 const allocator_type & alloc = allocator_type() )
+		: _words(_word_count(n), _fill_word(val), word_allocator_type(alloc)), _size(n) {
+		_clear_tail();
+	} // fill
+
+	template <typename InputIterator>
+	vector( typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first,
+			InputIterator last,
+			const allocator_type & alloc = allocator_type() )
+		: _words(word_allocator_type(alloc)), _size(0) {
+		_range_initialize(first, last, ft::_iterator_category(first));
+	} // range
+
+	vector( const vector & src ) : _words(src._words), _size(src._size) { /* no-op */ } // copy
+
+	/* Assignment operator */
+	vector &	operator = ( const vector & rhs ) {
+		_words = rhs._words;
+		_size = rhs._size;
+		return *this;
+	}
+
+	/* Destructor */
+	~vector( void ) { /* no-op */ }
+
+	/* Iterators */
+	iterator				begin( void ) { return iterator(_words.data(), 0); }
+	const_iterator			begin( void ) const { return const_iterator(const_cast<word_type *>(_words.data()), 0); }
+	iterator				end( void ) { return begin() + _size; }
+	const_iterator			end( void ) const { return begin() + _size; }
+	reverse_iterator		rbegin( void ) { return reverse_iterator(end()); }
+	const_reverse_iterator	rbegin( void ) const { return const_reverse_iterator(end()); }
+	reverse_iterator		rend( void ) { return reverse_iterator(begin()); }
+	const_reverse_iterator	rend( void ) const { return const_reverse_iterator(begin()); }
+
+	/* Capacity */
+	size_type	size( void ) const { return _size; }
+	bool		empty( void ) const { return !_size; }
+
+	size_type	max_size( void ) const {
+		const size_type	words = _words.max_size();
+
+		return words > npos / _bit_word_size ? npos : words * _bit_word_size;
+	}
+
+	size_type	capacity( void ) const { return _words.capacity() * _bit_word_size; }
+
+	void	resize( size_type n, value_type val = value_type() ) {
+		if (n > _size) {
+			insert(end(), n - _size, val);
+		} else {
+			_erase_at_end(n);
+		}
+	}
+
+	void	reserve( size_type n ) {
+		if (n > max_size()) {
+			throw std::length_error("vector::reserve");
+		}
+		_words.reserve(_word_count(n));
+	}
+
+	void	shrink_to_fit( void ) { _words.shrink_to_fit(); }
+
+	/* Element access */
+	reference		operator [] ( size_type n ) { return *iterator(_words.data() + n / _bit_word_size, n % _bit_word_size); }
+	const_reference	operator [] ( size_type n ) const { return (_words[n / _bit_word_size] >> (n % _bit_word_size)) & 1; }
+	reference		at( size_type n ) { _check_range(n); return (*this)[n]; }
+	const_reference	at( size_type n ) const { _check_range(n); return (*this)[n]; }
+	reference		front( void ) { return (*this)[0]; }
+	const_reference	front( void ) const { return (*this)[0]; }
+	reference		back( void ) { return (*this)[_size - 1]; }
+	const_reference	back( void ) const { return (*this)[_size - 1]; }
+
+	// The storage, (size() + _bit_word_size - 1) / _bit_word_size words
+	word_type *			words( void ) { return _words.data(); }
+	const word_type *	words( void ) const { return _words.data(); }
+
+	/* Bit operations */
+
+	// Number of set bits
+	size_type	count( void ) const {
+		const word_type *	w = _words.data();
+		size_type			n = 0;
+
+		for (size_type i = 0; i < _words.size(); i++) {
+			n += _popcount(w[i]);
+		}
+		return n;
+	}
+
+	// Index of the first set bit, npos if none
+	size_type	find_first( void ) const { return _size ? _find_from(0) : npos; }
+
+	// Index of the first set bit after pos, npos if none
+	size_type	find_next( size_type pos ) const {
+		if (pos >= _size || ++pos == _size) {
+			return npos;
+		}
+		return _find_from(pos);
+	}
+
+	// Flips every bit
+	void	flip( void ) {
+		word_type *	w = _words.data();
+
+		for (size_type i = 0; i < _words.size(); i++) {
+			w[i] = ~w[i];
+		}
+		_clear_tail();
+	}
+
+	/*
+	**	Element wise and / or / xor with a vector of the same size, a word (or
+	**	a vector register of words) at a time.
+	*/
+	vector &	operator &= ( const vector & rhs ) { _combine(rhs, _bit_and(), "vector<bool>::operator&="); return *this; }
+	vector &	operator |= ( const vector & rhs ) { _combine(rhs, _bit_or(), "vector<bool>::operator|="); return *this; }
+	vector &	operator ^= ( const vector & rhs ) { _combine(rhs, _bit_xor(), "vector<bool>::operator^="); return *this; }
+
+	/* Modifiers */
+	template <typename InputIterator>
+	void	assign( typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first,
+					InputIterator last ) {
+		vector	tmp(first, last, get_allocator());
+
+		swap(tmp);
+	} // range
+
+	void	assign( size_type n, const value_type & val ) {
+		_words.assign(_word_count(n), _fill_word(val));
+		_size = n;
+		_clear_tail();
+	} // fill
+
+	void	push_back( const value_type & val ) {
+		if (_size % _bit_word_size == 0) {
+			_words.push_back(0);
+		}
+		(*this)[_size++] = val;
+	}
+
+	void	pop_back( void ) { if (_size > 0) _erase_at_end(_size - 1); }
+
+	// single element
+	iterator	insert( iterator position, const value_type & val ) {
+		size_type	j = position - begin();
+
+		insert(position, size_type(1), val);
+		return begin() + j;
+	}
+
+	// fill
+	void	insert( iterator position, size_type n, const value_type & val ) {
+		size_type	j = position - begin();
+		bool		copy = val; // val may be one of our bits
+
+		_open_gap(j, n);
+		_fill(j, j + n, copy);
+	}
+
+	// range
+	template <typename InputIterator>
+	void	insert( iterator position,
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first,
+					InputIterator last ) {
+		_range_insert(position - begin(), first, last, ft::_iterator_category(first));
+	}
+
+	iterator	erase( iterator position ) { return erase(position, position + 1); } // single element
+
+	iterator	erase( iterator first, iterator last ) {
+		size_type	j = first - begin();
+
+		if (first != last) {
+			_erase_at_end(ft::copy(last, end(), first) - begin());
+		}
+		return begin() + j;
+	} // range
+
+	void	swap( vector & other ) {
+		size_type	tmp = _size;
+
+		_words.swap(other._words);
+		_size = other._size;
+		other._size = tmp;
+	}
+
+	static void	swap( reference lhs, reference rhs ) {
+		bool	tmp = lhs;
+
+		lhs = rhs;
+		rhs = tmp;
+	}
+
+	void	clear( void ) { _erase_at_end(0); }
+
+	/* Allocator */
+	allocator_type	get_allocator( void ) const { return allocator_type(_words.get_allocator()); }
+
+private:
+	struct _bit_and { template <typename W> W operator () ( W a, W b ) const { return a & b; } };
+	struct _bit_or { template <typename W> W operator () ( W a, W b ) const { return a | b; } };
+	struct _bit_xor { template <typename W> W operator () ( W a, W b ) const { return a ^ b; } };
+
+	static size_type	_word_count( size_type n ) { return n / _bit_word_size + (n % _bit_word_size != 0); }
+	static word_type	_fill_word( bool val ) { return val ? ~word_type(0) : word_type(0); }
+
+	static size_type	_popcount( word_type w ) {
+#if defined(__GNUC__) && defined(__POPCNT__)
+		return __builtin_popcountl(w);
+#else
+		// without a popcnt instruction the builtin is a libgcc call, the bit trick beats it
+		w = w - ((w >> 1) & (~word_type(0) / 3));
+		w = (w & (~word_type(0) / 15 * 3)) + ((w >> 2) & (~word_type(0) / 15 * 3));
+		w = (w + (w >> 4)) & (~word_type(0) / 255 * 15);
+		return (w * (~word_type(0) / 255)) >> (sizeof(word_type) - 1) * CHAR_BIT;
+#endif
+	}
+
+	static size_type	_ctz( word_type w ) {
+#if defined(__GNUC__)
+		return __builtin_ctzl(w);
+#else
+		size_type	n = 0;
+
+		for (; !(w & 1); w >>= 1) {
+			n++;
+		}
+		return n;
+#endif
+	}
+
+	// Index of the first set bit at or after pos < size()
+	size_type	_find_from( size_type pos ) const {
+		const word_type *	w = _words.data();
+		size_type			i = pos / _bit_word_size;
+		word_type			bits = w[i] & (~word_type(0) << (pos % _bit_word_size));
+
+		while (!bits) {
+			if (++i == _words.size()) {
+				return npos;
+			}
+			bits = w[i];
+		}
+		return i * _bit_word_size + _ctz(bits); // no bit is set past size()
+	}
+
+	// Zeroes the bits past size() in the last word
+	void	_clear_tail( void ) {
+		if (_size % _bit_word_size) {
+			_words.back() &= ~(~word_type(0) << (_size % _bit_word_size));
+		}
+	}
+
+	void	_erase_at_end( size_type n ) {
+		_size = n;
+		_words.resize(_word_count(n));
+		_clear_tail();
+	}
+
+	// Sets the bits [first, last) to val, whole words at once
+	void	_fill( size_type first, size_type last, bool val ) {
+		word_type *	w = _words.data();
+
+		for (; first != last && first % _bit_word_size; first++) {
+			(*this)[first] = val;
+		}
+		for (; last - first >= size_type(_bit_word_size); first += _bit_word_size) {
+			w[first / _bit_word_size] = _fill_word(val);
+		}
+		for (; first != last; first++) {
+			(*this)[first] = val;
+		}
+	}
+
+	// Makes room for n bits at index j, the bits in the gap are left as they are
+	void	_open_gap( size_type j, size_type n ) {
+		if (n == 0) {
+			return ;
+		}
+		if (n > max_size() - _size) {
+			throw std::length_error("vector<bool>::_M_fill_insert");
+		}
+		size_type	old_size = _size;
+
+		_words.resize(_word_count(_size + n));
+		_size += n;
+		ft::copy_backward(begin() + j, begin() + old_size, end());
+	}
+
+	template <typename BinaryOperation>
+	void	_combine( const vector & rhs, BinaryOperation op, const char * name ) {
+		if (rhs._size != _size) {
+			throw std::invalid_argument(name);
+		}
+		word_type *			dest = _words.data();
+		const word_type *	src = rhs._words.data();
+		size_type			n = _words.size();
+		size_type			i = 0;
+
+#if defined(__GNUC__)
+		// 16 bytes of words per step, a register on every target with SIMD
+		typedef word_type	block_type __attribute__((vector_size(16)));
+		const size_type		step = sizeof(block_type) / sizeof(word_type);
+
+		for (; i + step <= n; i += step) {
+			block_type	a;
+			block_type	b;
+
+			std::memcpy(&a, dest + i, sizeof(a));
+			std::memcpy(&b, src + i, sizeof(b));
+			a = op(a, b);
+			std::memcpy(dest + i, &a, sizeof(a));
+		}
+#endif
+		for (; i < n; i++) {
+			dest[i] = op(dest[i], src[i]);
+		}
+	}
+
+	/* Ranges */
+	template <typename InputIterator>
+	void	_range_initialize( InputIterator first, InputIterator last, ft::input_iterator_tag ) {
+		for (; first != last; ++first) {
+			push_back(*first);
+		}
+	} // single pass
+
+	template <typename ForwardIterator>
+	void	_range_initialize( ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag ) {
+		reserve(ft::distance(first, last));
+		for (; first != last; ++first) {
+			push_back(*first);
+		}
+	} // sized
+
+	template <typename InputIterator>
+	void	_range_insert( size_type j, InputIterator first, InputIterator last, ft::input_iterator_tag ) {
+		vector	tmp(first, last, get_allocator()); // can only be read once
+
+		_range_insert(j, tmp.begin(), tmp.end(), ft::random_access_iterator_tag());
+	} // single pass
+
+	template <typename ForwardIterator>
+	void	_range_insert( size_type j, ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag ) {
+		_open_gap(j, ft::distance(first, last));
+		ft::copy(first, last, begin() + j);
+	} // sized
+
+	void	_check_range( size_type n ) const {
+		if (n < _size) {
+			return ;
+		}
+#if defined(DARWIN)
+		throw std::out_of_range("vector");
+#else
+		throw std::out_of_range("vector<bool>::_M_range_check: __n (which is " + to_s(n)
+			+ ") >= this->size() (which is " + to_s(_size) + ")");
+#endif
+	}
+
+};
+
+template <typename Allocator, typename GrowthPolicy>
+const typename vector<bool, Allocator, GrowthPolicy>::size_type	vector<bool, Allocator, GrowthPolicy>::npos;
+
+// A word compare, the bits past size() being 0 on both sides
+template <typename Alloc, typename Growth>
+bool	operator == ( const vector<bool, Alloc, Growth> & lhs, const vector<bool, Alloc, Growth> & rhs ) {
+	const size_t	words = (lhs.size() + _bit_word_size - 1) / _bit_word_size;
+
+	return lhs.size() == rhs.size() && ft::equal(lhs.words(), lhs.words() + words, rhs.words());
+}
+
+template <typename Alloc, typename Growth>
+vector<bool, Alloc, Growth>	operator & ( const vector<bool, Alloc, Growth> & lhs, const vector<bool, Alloc, Growth> & rhs ) {
+	vector<bool, Alloc, Growth>	result(lhs);
+
+	return result &= rhs;
+}
+
+template <typename Alloc, typename Growth>
+vector<bool, Alloc, Growth>	operator | ( const vector<bool, Alloc, Growth> & lhs, const vector<bool, Alloc, Growth> & rhs ) {
+	vector<bool, Alloc, Growth>	result(lhs);
+
+	return result |= rhs;
+}
+
+template <typename Alloc, typename Growth>
+vector<bool, Alloc, Growth>	operator ^ ( const vector<bool, Alloc, Growth> & lhs, const vector<bool, Alloc, Growth> & rhs ) {
+	vector<bool, Alloc, Growth>	result(lhs);
+
+	return result ^= rhs;
+}
+
+}
@@ -0,0 +1,581 @@
+#pragma once
+
+#include <memory>
+#include <algorithm>
+#include <cstring> // memmove
+#include <stdexcept>
+
+#include "iterators/DequeIterator.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "algorithm.hpp"
+#include "memory.hpp"
+
+namespace ft {
+
+// ************************************************************************** //
+//                               deque template                               //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/container/deque
+**
+**	Elements live in fixed blocks of 512 bytes, reached through a map of block
+**	pointers. Growing at either end allocates one block at a time and never
+**	moves an element: only the map, a pointer per block, is ever copied. That
+**	keeps the worst push_back close to the average one, where a vector has to
+**	copy everything it holds when it runs out of capacity.
+**
+**	A new deque allocates nothing. From the first element on there is always
+**	one block allocated, the one _finish points into.
+*/
+
+template< typename T, typename Allocator = std::allocator<T> >
+class deque {
+
+public:
+	/* Member types */
+	typedef T													value_type;
+	typedef Allocator											allocator_type;
+	typedef typename allocator_type::reference					reference;
+	typedef typename allocator_type::const_reference			const_reference;
+	typedef typename allocator_type::pointer					pointer;
+	typedef typename allocator_type::const_pointer				const_pointer;
+	typedef DequeIterator<value_type>							iterator;
+	typedef DequeIterator<const value_type>						const_iterator;
+	typedef ft::reverse_iterator<iterator>						reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>				const_reverse_iterator;
+	typedef typename iterator_traits<iterator>::difference_type	difference_type;
+	typedef size_t												size_type;
+
+private:
+	typedef typename iterator::map_pointer								map_pointer;
+	typedef typename allocator_type::template rebind<pointer>::other	map_allocator_type;
+
+	enum { _initial_map_size = 8 };
+
+	/* Member variables */
+	map_pointer			_map;
+	size_type			_map_size;
+	iterator			_start;
+	iterator			_finish;
+	allocator_type		_allocator;
+	map_allocator_type	_map_allocator;
+
+public:
+	/* Constructors */
+	explicit deque( const allocator_type & alloc = allocator_type() )
+		: _map(NULL), _map_size(0), _allocator(alloc), _map_allocator(alloc) { /* no-op */ } // default
+
+	explicit deque( size_type n,
+					const value_type & val = value_type(),
+					const allocator_type & alloc = allocator_type() )
+		: _map(NULL), _map_size(0), _allocator(alloc), _map_allocator(alloc) {
+		try {
+			insert(end(), n, val);
+		} catch (...) {
+			_release();
+			throw;
+		}
+	} // fill
+
+	template <typename InputIterator>
+	deque( typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first,
+		   InputIterator last,
+		   const allocator_type & alloc = allocator_type() )
+		: _map(NULL), _map_size(0), _allocator(alloc), _map_allocator(alloc) {
+		try {
+			for (; first != last; ++first) {
+				push_back(*first);
+			}
+		} catch (...) {
+			_release();
+			throw;
+		}
+	} // range
+
+	deque( const deque & src ) : _map(NULL), _map_size(0), _allocator(src._allocator), _map_allocator(src._map_allocator) {
+		try {
+			for (const_iterator it = src.begin(); it != src.end(); ++it) {
+				push_back(*it);
+			}
+		} catch (...) {
+			_release();
+			throw;
+		}
+	} // copy
+
+	/* Assignment operator */
+	deque &	operator = ( const deque & rhs ) {
+		if (this != &rhs) {
+			deque	tmp(rhs);
+
+			swap(tmp);
+		}
+		return *this;
+	}
+
+	/* Destructor */
+	~deque( void ) { _release(); }
+
+	/* Iterators */
+	iterator				begin( void ) { return _start; }
+	const_iterator			begin( void ) const { return _start; }
+	iterator				end( void ) { return _finish; }
+	const_iterator			end( void ) const { return _finish; }
+	reverse_iterator		rbegin( void ) { return reverse_iterator(end()); }
+	const_reverse_iterator	rbegin( void ) const { return const_reverse_iterator(end()); }
+	reverse_iterator		rend( void ) { return reverse_iterator(begin()); }
+	const_reverse_iterator	rend( void ) const { return const_reverse_iterator(begin()); }
+
+	/* Capacity */
+	size_type	size( void ) const { return _finish - _start; }
+	size_type	max_size( void ) const { return _allocator.max_size(); }
+	bool		empty( void ) const { return _finish == _start; }
+
+	void	resize( size_type n, value_type val = value_type() ) {
+		if (n < size()) {
+			_erase_at_end(size() - n);
+		} else {
+			insert(end(), n - size(), val);
+		}
+	}
+
+	/* Element access */
+	reference		operator [] ( size_type n ) { return _start[n]; }
+	const_reference	operator [] ( size_type n ) const { return _start[n]; }
+	reference		at( size_type n ) { _check_range(n); return _start[n]; }
+	const_reference	at( size_type n ) const { _check_range(n); return _start[n]; }
+	reference		front( void ) { return *_start; }
+	const_reference	front( void ) const { return *_start; }
+	reference		back( void ) { return *(_finish - 1); }
+	const_reference	back( void ) const { return *(_finish - 1); }
+
+	/* Modifiers */
+	template <typename InputIterator>
+	void	assign( typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first,
+					InputIterator last ) {
+		deque	tmp(first, last, _allocator);
+
+		swap(tmp);
+	} // range
+
+	void	assign( size_type n, const value_type & val ) {
+		const value_type	copy(val); // val may be one of the elements
+		size_type			live = std::min(n, size());
+
+		ft::fill(begin(), begin() + live, copy);
+		if (n > live) {
+			insert(end(), n - live, copy);
+		} else {
+			_erase_at_end(size() - n);
+		}
+	} // fill
+
+	void	push_back( const value_type & val ) {
+		if (_finish.last() - _finish.cur() > 1) {
+			_allocator.construct(_finish.cur(), val);
+			++_finish;
+			return ;
+		}
+		if (!_map) {
+			_initialize_map();
+			push_back(val);
+			return ;
+		}
+		_reserve_map_at_back();
+		*(_finish.node() + 1) = _allocator.allocate(iterator::block_size());
+		try {
+			_allocator.construct(_finish.cur(), val);
+		} catch (...) {
+			_allocator.deallocate(*(_finish.node() + 1), iterator::block_size());
+			throw;
+		}
+		++_finish;
+	}
+
+	void	push_front( const value_type & val ) {
+		if (_start.cur() != _start.first()) {
+			_allocator.construct(_start.cur() - 1, val);
+			--_start;
+			return ;
+		}
+		if (!_map) {
+			_initialize_map();
+			push_front(val);
+			return ;
+		}
+		_reserve_map_at_front();
+		*(_start.node() - 1) = _allocator.allocate(iterator::block_size());
+		try {
+			_allocator.construct(*(_start.node() - 1) + iterator::block_size() - 1, val);
+		} catch (...) {
+			_allocator.deallocate(*(_start.node() - 1), iterator::block_size());
+			throw;
+		}
+		--_start;
+	}
+
+	void	pop_back( void ) {
+		if (_finish.cur() == _finish.first()) {
+			_allocator.deallocate(_finish.first(), iterator::block_size());
+		}
+		--_finish;
+		_allocator.destroy(_finish.cur());
+	}
+
+	void	pop_front( void ) {
+		_allocator.destroy(_start.cur());
+		if (_start.cur() == _start.last() - 1) {
+			_allocator.deallocate(_start.first(), iterator::block_size());
+		}
+		++_start;
+	}
+
+	// single element
+	iterator	insert( iterator position, const value_type & val ) {
+		difference_type	i = position - begin();
+
+		insert(position, size_type(1), val);
+		return begin() + i;
+	}
+
+	/*
+	**	Inserting grows the deque at the end closest to position, then shifts
+	**	the elements in between over the new slots.
+	*/
+
+	// fill
+	void	insert( iterator position, size_type n, const value_type & val ) {
+		if (n == 0) {
+			return ;
+		}
+		const value_type	copy(val); // val may be one of the elements
+		size_type			i = position - begin();
+
+		if (i < size() / 2) {
+			_grow_front(n, copy);
+			ft::copy(begin() + n, begin() + n + i, begin());
+		} else {
+			_grow_back(n, copy);
+			ft::copy_backward(begin() + i, end() - n, end());
+		}
+		ft::fill(begin() + i, begin() + i + n, copy);
+	}
+
+	// range
+	template <typename InputIterator>
+	void	insert( iterator position,
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first,
+					InputIterator last ) {
+		_range_insert(position - begin(), first, last, ft::_iterator_category(first));
+	}
+
+	iterator	erase( iterator position ) { return erase(position, position + 1); } // single element
+
+	// Shifts the shorter side over the gap, then drops that many elements at its end
+	iterator	erase( iterator first, iterator last ) {
+		size_type	n = last - first;
+		size_type	i = first - begin();
+
+		if (n == 0) {
+			return first;
+		}
+		if (i < (size() - n) / 2) {
+			ft::copy_backward(begin(), first, last);
+			_erase_at_begin(n);
+		} else {
+			ft::copy(last, end(), first);
+			_erase_at_end(n);
+		}
+		return begin() + i;
+	} // range
+
+	void	swap( deque & other ) {
+		std::swap(_map, other._map);
+		std::swap(_map_size, other._map_size);
+		std::swap(_start, other._start);
+		std::swap(_finish, other._finish);
+		std::swap(_allocator, other._allocator);
+		std::swap(_map_allocator, other._map_allocator);
+	}
+
+	void	clear( void ) { _erase_at_end(size()); }
+
+	/* Allocator */
+	allocator_type	get_allocator( void ) const { return _allocator; }
+
+private:
+	/* Map */
+
+	/*
+	**	A deque starts without a map: default construction allocates nothing,
+	**	which is what makes swap relocation cheap. The first element brings in
+	**	the map and one block in its middle.
+	*/
+	void	_initialize_map( void ) {
+		_map_size = _initial_map_size;
+		_map = _map_allocator.allocate(_map_size);
+
+		map_pointer	node = _map + _map_size / 2;
+
+		try {
+			*node = _allocator.allocate(iterator::block_size());
+		} catch (...) {
+			_map_allocator.deallocate(_map, _map_size);
+			throw;
+		}
+		_start = iterator(*node, node);
+		_finish = _start;
+	}
+
+	void	_release( void ) {
+		if (!_map) {
+			return ;
+		}
+		clear();
+		_allocator.deallocate(_finish.first(), iterator::block_size());
+		_map_allocator.deallocate(_map, _map_size);
+	}
+
+	void	_reserve_map_at_back( size_type nodes = 1 ) {
+		if (nodes + 1 > _map_size - (_finish.node() - _map)) {
+			_reallocate_map(nodes, false);
+		}
+	}
+
+	void	_reserve_map_at_front( size_type nodes = 1 ) {
+		if (nodes > static_cast<size_type>(_start.node() - _map)) {
+			_reallocate_map(nodes, true);
+		}
+	}
+
+	/*
+	**	Makes room for `add` more block pointers at one end. The used slots are
+	**	recentred in place when the map is less than half full, or copied to a
+	**	map at least twice as large.
+	*/
+	void	_reallocate_map( size_type add, bool at_front ) {
+		size_type	old_nodes = _finish.node() - _start.node() + 1;
+		size_type	new_nodes = old_nodes + add;
+		map_pointer	new_start;
+
+		if (_map_size > 2 * new_nodes) {
+			new_start = _map + (_map_size - new_nodes) / 2 + (at_front ? add : 0);
+			std::memmove(static_cast<void *>(new_start), static_cast<void *>(_start.node()), old_nodes * sizeof(pointer));
+		} else {
+			size_type	new_map_size = _map_size + std::max(_map_size, add) + 2;
+			map_pointer	new_map = _map_allocator.allocate(new_map_size);
+
+			new_start = new_map + (new_map_size - new_nodes) / 2 + (at_front ? add : 0);
+			std::memcpy(static_cast<void *>(new_start), static_cast<void *>(_start.node()), old_nodes * sizeof(pointer));
+			_map_allocator.deallocate(_map, _map_size);
+			_map = new_map;
+			_map_size = new_map_size;
+		}
+		_start = iterator(_start.cur(), new_start);
+		_finish = iterator(_finish.cur(), new_start + old_nodes - 1);
+	}
+
+	/* Growing and shrinking at the ends */
+
+	// Constructs n copies of val before the first element
+	void	_grow_front( size_type n, const value_type & val ) {
+		if (!_map) {
+			_initialize_map();
+		}
+		size_type	vacancies = _start.cur() - _start.first();
+
+		if (n > vacancies) {
+			size_type	blocks = (n - vacancies + iterator::block_size() - 1) / iterator::block_size();
+
+			_reserve_map_at_front(blocks);
+			for (size_type i = 1; i <= blocks; i++) {
+				try {
+					*(_start.node() - i) = _allocator.allocate(iterator::block_size());
+				} catch (...) {
+					_free_blocks(_start.node() - i + 1, _start.node());
+					throw;
+				}
+			}
+		}
+		iterator	new_start = _start - n;
+
+		try {
+			_uninitialized_fill(new_start, _start, val);
+		} catch (...) {
+			_free_blocks(new_start.node(), _start.node());
+			throw;
+		}
+		_start = new_start;
+	}
+
+	// Constructs n copies of val after the last element
+	void	_grow_back( size_type n, const value_type & val ) {
+		if (!_map) {
+			_initialize_map();
+		}
+		size_type	vacancies = _finish.last() - _finish.cur() - 1;
+
+		if (n > vacancies) {
+			size_type	blocks = (n - vacancies + iterator::block_size() - 1) / iterator::block_size();
+
+			_reserve_map_at_back(blocks);
+			for (size_type i = 1; i <= blocks; i++) {
+				try {
+					*(_finish.node() + i) = _allocator.allocate(iterator::block_size());
+				} catch (...) {
+					_free_blocks(_finish.node() + 1, _finish.node() + i);
+					throw;
+				}
+			}
+		}
+		iterator	new_finish = _finish + n;
+
+		try {
+			_uninitialized_fill(_finish, new_finish, val);
+		} catch (...) {
+			_free_blocks(_finish.node() + 1, new_finish.node() + 1);
+			throw;
+		}
+		_finish = new_finish;
+	}
+
+	void	_erase_at_begin( size_type n ) {
+		if (n == 0) {
+			return ;
+		}
+		iterator	new_start = _start + n;
+
+		_destroy(_start, new_start);
+		_free_blocks(_start.node(), new_start.node());
+		_start = new_start;
+	}
+
+	void	_erase_at_end( size_type n ) {
+		if (n == 0) {
+			return ;
+		}
+		iterator	new_finish = _finish - n;
+
+		_destroy(new_finish, _finish);
+		_free_blocks(new_finish.node() + 1, _finish.node() + 1);
+		_finish = new_finish;
+	}
+
+	// Constructs copies of val over [first, last), all or none
+	void	_uninitialized_fill( iterator first, iterator last, const value_type & val ) {
+		iterator	it = first;
+
+		try {
+			for (; it != last; ++it) {
+				_allocator.construct(it.cur(), val);
+			}
+		} catch (...) {
+			_destroy(first, it);
+			throw;
+		}
+	}
+
+	// Destroys [first, last) a block at a time
+	void	_destroy( iterator first, iterator last ) {
+		if (first.node() == last.node()) {
+			ft::destroy(first.cur(), last.cur(), _allocator);
+			return ;
+		}
+		ft::destroy(first.cur(), first.last(), _allocator);
+		for (map_pointer node = first.node() + 1; node < last.node(); ++node) {
+			ft::destroy(*node, *node + iterator::block_size(), _allocator);
+		}
+		ft::destroy(last.first(), last.cur(), _allocator);
+	}
+
+	void	_free_blocks( map_pointer first, map_pointer last ) {
+		for (; first < last; ++first) {
+			_allocator.deallocate(*first, iterator::block_size());
+		}
+	}
+
+	/* Ranges */
+	template <typename InputIterator>
+	void	_range_insert( size_type i, InputIterator first, InputIterator last, ft::input_iterator_tag ) {
+		deque	tmp(first, last, _allocator);
+
+		_range_insert(i, tmp.begin(), tmp.end(), ft::random_access_iterator_tag());
+	}
+
+	// Grows with copies of the first element, then overwrites the gap with the range
+	template <typename ForwardIterator>
+	void	_range_insert( size_type i, ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag ) {
+		size_type	n = ft::distance(first, last);
+
+		if (n == 0) {
+			return ;
+		}
+		const value_type	filler(*first);
+
+		if (i < size() / 2) {
+			_grow_front(n, filler);
+			ft::copy(begin() + n, begin() + n + i, begin());
+		} else {
+			_grow_back(n, filler);
+			ft::copy_backward(begin() + i, end() - n, end());
+		}
+		ft::copy(first, last, begin() + i);
+	}
+
+	void	_check_range( size_type n ) const {
+		if (n >= size()) {
+			throw std::out_of_range("deque::at");
+		}
+	}
+
+};
+
+// relational operators
+template <typename T, typename Alloc>
+bool	operator == ( const deque<T, Alloc> & lhs, const deque<T, Alloc> & rhs ) {
+	return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename T, typename Alloc>
+bool	operator != ( const deque<T, Alloc> & lhs, const deque<T, Alloc> & rhs ) { return !(lhs == rhs); }
+
+template <typename T, typename Alloc>
+bool	operator < ( const deque<T, Alloc> & lhs, const deque<T, Alloc> & rhs ) {
+	return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename T, typename Alloc>
+bool	operator <= ( const deque<T, Alloc> & lhs, const deque<T, Alloc> & rhs ) { return !(rhs < lhs); }
+
+template <typename T, typename Alloc>
+bool	operator > ( const deque<T, Alloc> & lhs, const deque<T, Alloc> & rhs ) { return rhs < lhs; }
+
+template <typename T, typename Alloc>
+bool	operator >= ( const deque<T, Alloc> & lhs, const deque<T, Alloc> & rhs ) { return !(lhs < rhs); }
+
+// swap
+template <typename T, typename Alloc>
+void	swap( deque<T, Alloc> & lhs, deque<T, Alloc> & rhs ) { lhs.swap(rhs); }
+
+// erase / erase_if, as for ft::vector
+template <typename T, typename Alloc, typename Predicate>
+typename deque<T, Alloc>::size_type	erase_if( deque<T, Alloc> & d, Predicate pred ) {
+	typename deque<T, Alloc>::iterator	last = ft::remove_if(d.begin(), d.end(), pred);
+	typename deque<T, Alloc>::size_type	n = d.end() - last;
+
+	d.erase(last, d.end());
+	return n;
+}
+
+template <typename T, typename Alloc, typename U>
+typename deque<T, Alloc>::size_type	erase( deque<T, Alloc> & d, const U & val ) {
+	return ft::erase_if(d, _equal_to_value<U>(val));
+}
+
+// relocation
+template <typename T, typename Alloc>
+struct is_swap_relocatable< deque<T, Alloc> > : true_type { /* no-op */ };
+
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef> // size_t
+
+namespace ft {
+
+// ************************************************************************** //
+//                             growth policies                                //
+// ************************************************************************** //
+
+/*
+**	A growth policy decides the new capacity of a container that ran out of
+**	room. `grow` receives the current size, the size that must fit, the
+**	container's max_size and the size in bytes of one element, and returns a
+**	capacity of at least `required`.
+*/
+
+/*
+**	Geometric growth by Num / Den.
+**
+**	factor_growth<2, 1> doubles (the std::vector behaviour, and the default).
+**	factor_growth<3, 2> grows by 1.5x: the sum of the previously freed blocks
+**	eventually becomes large enough to hold the next one, so the allocator can
+**	reuse them.
+*/
+template <size_t Num, size_t Den>
+struct factor_growth {
+
+	static size_t	grow( size_t size, size_t required, size_t max_size, size_t value_size ) {
+		size_t	extra = size / Den * (Num - Den) + size % Den * (Num - Den) / Den;
+
+		(void)value_size;
+		if (extra < required - size) {
+			extra = required - size;
+		}
+		if (extra > max_size - size) {
+			return max_size;
+		}
+		return size + extra;
+	}
+
+};
+
+/*
+**	Doubles, then rounds the size in bytes up to a multiple of PageSize once
+**	the buffer is at least one page long, so large buffers never leave most
+**	of their last page unused. Use 4096 for regular pages and 2097152 for
+**	huge pages.
+**
+**	The capacity is the number of whole elements that fit in those pages:
+**	when value_size does not divide PageSize, the buffer stops short of the
+**	page boundary by less than one element.
+*/
+template <size_t PageSize = 4096>
+struct page_growth {
+
+	static size_t	grow( size_t size, size_t required, size_t max_size, size_t value_size ) {
+		size_t	capacity = factor_growth<2, 1>::grow(size, required, max_size, value_size);
+		size_t	bytes = capacity * value_size;
+
+		if (bytes < PageSize || bytes > static_cast<size_t>(-1) - PageSize) {
+			return capacity;
+		}
+		bytes = (bytes + PageSize - 1) / PageSize * PageSize;
+		capacity = bytes / value_size;
+		return capacity > max_size ? max_size : capacity;
+	}
+
+};
+
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef> // ptrdiff_t
+#include <iterator> // std iterator tags
 
 namespace ft {
 
@@ -21,8 +22,11 @@ struct iterator {
 	typedef Category  iterator_category;
 };
 
-struct bidirectional_iterator_tag { /* no-op */ };
-struct random_access_iterator_tag { /* no-op */ };
+struct input_iterator_tag { /* no-op */ };
+struct output_iterator_tag { /* no-op */ };
+struct forward_iterator_tag : public input_iterator_tag { /* no-op */ };
+struct bidirectional_iterator_tag : public forward_iterator_tag { /* no-op */ };
+struct random_access_iterator_tag : public bidirectional_iterator_tag { /* no-op */ };
 
 
 // ************************************************************************** //
@@ -163,4 +167,90 @@ typename reverse_iterator<Iterator>::difference_type
                	 const reverse_iterator<Iterator>& rhs )
 	{ return rhs.base() - lhs.base(); }
 
+
+// ************************************************************************** //
+//                            iterator category                               //
+// ************************************************************************** //
+
+/*
+**	Maps the std tags onto ours so iterators coming from the standard library
+**	(std::list, std::istream_iterator...) take the same dispatch paths.
+*/
+
+template <typename Category>
+struct _category { typedef Category type; };
+
+template <>
+struct _category<std::input_iterator_tag> { typedef input_iterator_tag type; };
+
+template <>
+struct _category<std::output_iterator_tag> { typedef output_iterator_tag type; };
+
+template <>
+struct _category<std::forward_iterator_tag> { typedef forward_iterator_tag type; };
+
+template <>
+struct _category<std::bidirectional_iterator_tag> { typedef bidirectional_iterator_tag type; };
+
+template <>
+struct _category<std::random_access_iterator_tag> { typedef random_access_iterator_tag type; };
+
+template <typename Iterator>
+typename _category<typename iterator_traits<Iterator>::iterator_category>::type
+	_iterator_category( const Iterator & ) {
+	return typename _category<typename iterator_traits<Iterator>::iterator_category>::type();
+}
+
+
+// ************************************************************************** //
+//                           distance & advance                               //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/iterator/distance
+**	https://en.cppreference.com/w/cpp/iterator/advance
+*/
+
+template <typename Iterator>
+typename iterator_traits<Iterator>::difference_type
+	_distance( Iterator first, Iterator last, input_iterator_tag ) {
+	typename iterator_traits<Iterator>::difference_type	n = 0;
+
+	for (; first != last; ++first) {
+		n++;
+	}
+	return n;
+}
+
+template <typename Iterator>
+typename iterator_traits<Iterator>::difference_type
+	_distance( Iterator first, Iterator last, random_access_iterator_tag ) { return last - first; }
+
+template <typename Iterator>
+typename iterator_traits<Iterator>::difference_type
+	distance( Iterator first, Iterator last ) { return _distance(first, last, _iterator_category(first)); }
+
+template <typename Iterator, typename Distance>
+void	_advance( Iterator & it, Distance n, input_iterator_tag ) {
+	for (; n > 0; n--) {
+		++it;
+	}
+}
+
+template <typename Iterator, typename Distance>
+void	_advance( Iterator & it, Distance n, bidirectional_iterator_tag ) {
+	for (; n > 0; n--) {
+		++it;
+	}
+	for (; n < 0; n++) {
+		--it;
+	}
+}
+
+template <typename Iterator, typename Distance>
+void	_advance( Iterator & it, Distance n, random_access_iterator_tag ) { it += n; }
+
+template <typename Iterator, typename Distance>
+void	advance( Iterator & it, Distance n ) { _advance(it, n, _iterator_category(it)); }
+
 }
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <climits> // CHAR_BIT
+#include <cstddef> // ptrdiff_t
+
+#include "iterator.hpp"
+#include "type_traits.hpp"
+
+namespace ft {
+
+// The unit vector<bool> stores its bits in
+typedef unsigned long	_bit_word;
+
+enum { _bit_word_size = sizeof(_bit_word) * CHAR_BIT };
+
+// ************************************************************************** //
+//                               BitReference                                 //
+// ************************************************************************** //
+
+/*
+**	What dereferencing a vector<bool> gives: the word holding the bit and the
+**	mask selecting it. It reads as a bool, and assigning to it sets or clears
+**	that one bit.
+*/
+
+class BitReference {
+
+public:
+	BitReference( _bit_word * word, _bit_word mask ) : _word(word), _mask(mask) { /* no-op */ }
+	BitReference( const BitReference & src ) : _word(src._word), _mask(src._mask) { /* no-op */ }
+	~BitReference( void ) { /* no-op */ }
+
+	operator bool ( void ) const { return (*_word & _mask) != 0; }
+
+	// Assignment writes the bit, it never rebinds
+	BitReference &	operator = ( bool x ) {
+		if (x) {
+			*_word |= _mask;
+		} else {
+			*_word &= ~_mask;
+		}
+		return *this;
+	}
+
+	BitReference &	operator = ( const BitReference & rhs ) { return *this = bool(rhs); }
+
+	bool	operator ~ ( void ) const { return !bool(*this); }
+	void	flip( void ) { *_word ^= _mask; }
+
+private:
+	BitReference( void );
+
+	_bit_word *	_word;
+	_bit_word	_mask;
+
+};
+
+// ************************************************************************** //
+//                            BitIterator template                            //
+// ************************************************************************** //
+
+/*
+**	A position in a vector<bool>: a word and the offset of the bit within it.
+**	BitIterator<bool> dereferences to a BitReference, BitIterator<const bool>
+**	to a plain bool.
+*/
+
+template <typename T>
+struct _bit_iterator_traits {
+	typedef BitReference	reference;
+	typedef BitReference *	pointer;
+};
+
+template <>
+struct _bit_iterator_traits<const bool> {
+	typedef bool			reference;
+	typedef const bool *	pointer;
+};
+
+template <typename T>
+class BitIterator {
+
+	typedef BitIterator	type;
+
+public:
+	typedef random_access_iterator_tag							iterator_category;
+	typedef bool												value_type;
+	typedef ptrdiff_t											difference_type;
+	typedef typename _bit_iterator_traits<T>::reference			reference;
+	typedef typename _bit_iterator_traits<T>::pointer			pointer;
+
+	BitIterator( _bit_word * word, unsigned int offset ) : _word(word), _offset(offset) { /* no-op */ }
+
+	/* Getters */
+	_bit_word *		word( void ) const { return _word; }
+	unsigned int	offset( void ) const { return _offset; }
+
+	/* All iterators */
+	template <typename U>
+	BitIterator( const BitIterator<U> & src ) : _word(src.word()), _offset(src.offset()) { /* no-op */ }
+	BitIterator( type const & src ) : _word(src._word), _offset(src._offset) { /* no-op */ }
+	~BitIterator( void ) { /* no-op */ }
+	type &	operator = ( type const & rhs ) { _word = rhs._word; _offset = rhs._offset; return *this; }
+
+	type &	operator ++ ( void ) {
+		if (++_offset == _bit_word_size) {
+			_offset = 0;
+			++_word;
+		}
+		return *this;
+	}
+	type	operator ++ ( int ) { type tmp(*this); operator++(); return tmp; }
+
+	/* Output iterators */
+	reference	operator * ( void ) const { return reference(BitReference(_word, _bit_word(1) << _offset)); }
+
+	/* Forward iterators */
+	BitIterator( void ) : _word(NULL), _offset(0) { /* no-op */ }
+
+	/* Bidirectional iterators */
+	type &	operator -- ( void ) {
+		if (_offset-- == 0) {
+			_offset = _bit_word_size - 1;
+			--_word;
+		}
+		return *this;
+	}
+	type	operator -- ( int ) { type tmp(*this); operator--(); return tmp; }
+
+	/* Random Access iterators */
+	type &	operator += ( difference_type n ) {
+		difference_type	bit = n + _offset;
+
+		_word += bit / _bit_word_size;
+		bit %= _bit_word_size;
+		if (bit < 0) {
+			bit += _bit_word_size;
+			--_word;
+		}
+		_offset = static_cast<unsigned int>(bit);
+		return *this;
+	}
+	type &	operator -= ( difference_type n ) { return *this += -n; }
+
+	type	operator + ( difference_type n ) const { type tmp(*this); return tmp += n; }
+	type	operator - ( difference_type n ) const { type tmp(*this); return tmp -= n; }
+
+	reference	operator [] ( difference_type n ) const { return *(*this + n); }
+
+private:
+	_bit_word *		_word;
+	unsigned int	_offset;
+
+};
+
+// Non-member operators
+template <typename T, typename U>
+bool	operator == ( const BitIterator<T> & lhs, const BitIterator<U> & rhs ) {
+	return lhs.word() == rhs.word() && lhs.offset() == rhs.offset();
+}
+
+template <typename T, typename U>
+bool	operator != ( const BitIterator<T> & lhs, const BitIterator<U> & rhs ) { return !(lhs == rhs); }
+
+template <typename T, typename U>
+bool	operator < ( const BitIterator<T> & lhs, const BitIterator<U> & rhs ) {
+	return lhs.word() < rhs.word() || (lhs.word() == rhs.word() && lhs.offset() < rhs.offset());
+}
+
+template <typename T, typename U>
+bool	operator <= ( const BitIterator<T> & lhs, const BitIterator<U> & rhs ) { return !(rhs < lhs); }
+
+template <typename T, typename U>
+bool	operator > ( const BitIterator<T> & lhs, const BitIterator<U> & rhs ) { return rhs < lhs; }
+
+template <typename T, typename U>
+bool	operator >= ( const BitIterator<T> & lhs, const BitIterator<U> & rhs ) { return !(lhs < rhs); }
+
+template <typename T, typename U>
+ptrdiff_t	operator - ( const BitIterator<T> & lhs, const BitIterator<U> & rhs ) {
+	return (lhs.word() - rhs.word()) * ptrdiff_t(_bit_word_size)
+		+ ptrdiff_t(lhs.offset()) - ptrdiff_t(rhs.offset());
+}
+
+template <typename T>
+BitIterator<T>	operator + ( ptrdiff_t n, const BitIterator<T> & it ) { return it + n; }
+
+}
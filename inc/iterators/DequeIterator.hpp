@@ -0,0 +1,170 @@
+#pragma once
+
+#include "iterator.hpp"
+#include "type_traits.hpp"
+
+namespace ft {
+
+// Elements per deque block: 512 bytes worth, at least one
+template <typename T>
+struct _deque_block {
+	enum { size = sizeof(T) < 512 ? 512 / sizeof(T) : 1 };
+};
+
+// ************************************************************************** //
+//                          DequeIterator template                            //
+// ************************************************************************** //
+
+/*
+**	A position in a deque: the element, the bounds of its block and the slot
+**	of that block in the map. Stepping past either bound moves to the next
+**	slot of the map.
+*/
+
+template <typename T>
+class DequeIterator : public ft::iterator<ft::random_access_iterator_tag, T> {
+
+	typedef DequeIterator	type;
+
+public:
+
+	/* Inherited from ft::iterator */
+	typedef typename DequeIterator::pointer				pointer;
+	typedef typename DequeIterator::reference			reference;
+	typedef typename DequeIterator::value_type			value_type;
+	typedef typename DequeIterator::difference_type		difference_type;
+	typedef typename DequeIterator::iterator_category	iterator_category;
+
+	typedef typename remove_const<T>::type *			block_pointer;
+	typedef block_pointer *								map_pointer;
+
+	static difference_type	block_size( void ) { return _deque_block<T>::size; }
+
+	DequeIterator( pointer cur, map_pointer node )
+		: _cur(cur), _first(*node), _last(*node + block_size()), _node(node) { /* no-op */ }
+
+	/* Getters */
+	pointer		cur( void ) const { return _cur; }
+	pointer		first( void ) const { return _first; }
+	pointer		last( void ) const { return _last; }
+	map_pointer	node( void ) const { return _node; }
+
+	/* All iterators */
+	template <typename U>
+	DequeIterator( const DequeIterator<U> & src )
+		: _cur(src.cur()), _first(src.first()), _last(src.last()), _node(src.node()) { /* no-op */ }
+	DequeIterator( type const & src ) : _cur(src._cur), _first(src._first), _last(src._last), _node(src._node) { /* no-op */ }
+	~DequeIterator( void ) { /* no-op */ }
+
+	type &	operator = ( type const & rhs ) {
+		_cur = rhs._cur;
+		_first = rhs._first;
+		_last = rhs._last;
+		_node = rhs._node;
+		return *this;
+	}
+
+	type &	operator ++ ( void ) {
+		if (++_cur == _last) {
+			set_node(_node + 1);
+			_cur = _first;
+		}
+		return *this;
+	}
+	type	operator ++ ( int ) { type tmp(*this); operator++(); return tmp; }
+
+	/* Input iterators */
+	pointer		operator -> ( void ) const { return _cur; }
+
+	/* Output iterators */
+	reference	operator * ( void ) const { return *_cur; }
+
+	/* Forward iterators */
+	DequeIterator( void ) : _cur(NULL), _first(NULL), _last(NULL), _node(NULL) { /* no-op */ }
+
+	/* Bidirectional iterators */
+	type &	operator -- ( void ) {
+		if (_cur == _first) {
+			set_node(_node - 1);
+			_cur = _last;
+		}
+		--_cur;
+		return *this;
+	}
+	type	operator -- ( int ) { type tmp(*this); operator--(); return tmp; }
+
+	/* Random Access iterators */
+	type &	operator += ( difference_type n ) {
+		difference_type	offset = n + (_cur - _first);
+
+		if (offset >= 0 && offset < block_size()) {
+			_cur += n;
+		} else {
+			difference_type	nodes = offset > 0 ? offset / block_size() : -((-offset - 1) / block_size()) - 1;
+
+			set_node(_node + nodes);
+			_cur = _first + (offset - nodes * block_size());
+		}
+		return *this;
+	}
+	type &	operator -= ( difference_type n ) { return *this += -n; }
+
+	type	operator + ( difference_type n ) const { type tmp(*this); return tmp += n; }
+	type	operator - ( difference_type n ) const { type tmp(*this); return tmp -= n; }
+
+	reference	operator [] ( difference_type n ) const { return *(*this + n); }
+
+	// Moves to another block, leaving _cur for the caller to set
+	void	set_node( map_pointer node ) {
+		_node = node;
+		_first = *node;
+		_last = _first + block_size();
+	}
+
+private:
+
+	pointer		_cur;
+	pointer		_first;
+	pointer		_last;
+	map_pointer	_node;
+
+};
+
+// Non-member comparison overloads
+template <typename T, typename U>
+bool operator == ( const DequeIterator<T> & lhs, const DequeIterator<U> & rhs ) {
+	return lhs.cur() == rhs.cur();
+}
+
+template <typename T, typename U>
+bool operator != ( const DequeIterator<T> & lhs, const DequeIterator<U> & rhs ) {
+	return lhs.cur() != rhs.cur();
+}
+
+template <typename T, typename U>
+bool operator < ( const DequeIterator<T> & lhs, const DequeIterator<U> & rhs ) {
+	return lhs.node() == rhs.node() ? lhs.cur() < rhs.cur() : lhs.node() < rhs.node();
+}
+
+template <typename T, typename U>
+bool operator <= ( const DequeIterator<T> & lhs, const DequeIterator<U> & rhs ) { return !(rhs < lhs); }
+
+template <typename T, typename U>
+bool operator > ( const DequeIterator<T> & lhs, const DequeIterator<U> & rhs ) { return rhs < lhs; }
+
+template <typename T, typename U>
+bool operator >= ( const DequeIterator<T> & lhs, const DequeIterator<U> & rhs ) { return !(lhs < rhs); }
+
+template <typename T, typename U>
+typename DequeIterator<T>::difference_type
+operator - ( const DequeIterator<T> & lhs, const DequeIterator<U> & rhs ) {
+	return DequeIterator<T>::block_size() * (lhs.node() - rhs.node())
+		+ (lhs.cur() - lhs.first()) - (rhs.cur() - rhs.first());
+}
+
+template <typename T>
+DequeIterator<T>	operator + ( typename DequeIterator<T>::difference_type n, const DequeIterator<T> & it ) {
+	return it + n;
+}
+
+}
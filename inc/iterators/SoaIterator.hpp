@@ -0,0 +1,310 @@
+#pragma once
+
+#include <cstddef> // ptrdiff_t
+
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+
+namespace ft {
+
+// ************************************************************************** //
+//                           SoaReference template                            //
+// ************************************************************************** //
+
+/*
+**	What dereferencing a SoaIterator gives: a pair of references to the two
+**	columns of one row. It reads as its value_type, and assigning to it writes
+**	through to both columns, so the algorithms that move values around
+**	(ft::sort, ft::copy...) work on a soa_vector unchanged.
+*/
+
+template <typename F, typename S>
+struct SoaReference {
+
+	typedef typename remove_const<F>::type		first_type;
+	typedef typename remove_const<S>::type		second_type;
+	typedef pair<first_type, second_type>		value_type;
+
+	F &	first;
+	S &	second;
+
+	SoaReference( F & first, S & second ) : first(first), second(second) { /* no-op */ }
+	SoaReference( const SoaReference & src ) : first(src.first), second(src.second) { /* no-op */ }
+	template <typename F2, typename S2>
+	SoaReference( const SoaReference<F2, S2> & src ) : first(src.first), second(src.second) { /* no-op */ }
+	~SoaReference( void ) { /* no-op */ }
+
+	operator value_type ( void ) const { return value_type(first, second); }
+
+	// Assignment writes through, it never rebinds
+	SoaReference &	operator = ( const SoaReference & rhs ) {
+		first = rhs.first;
+		second = rhs.second;
+		return *this;
+	}
+
+	template <typename F2, typename S2>
+	SoaReference &	operator = ( const SoaReference<F2, S2> & rhs ) {
+		first = rhs.first;
+		second = rhs.second;
+		return *this;
+	}
+
+	template <typename T1, typename T2>
+	SoaReference &	operator = ( const pair<T1, T2> & rhs ) {
+		first = rhs.first;
+		second = rhs.second;
+		return *this;
+	}
+
+};
+
+/*
+**	Rows compare like ft::pair, against rows and pairs alike, without copying
+**	the elements.
+*/
+
+template <typename P, typename Q>
+bool	_row_equal( const P & lhs, const Q & rhs ) { return lhs.first == rhs.first && lhs.second == rhs.second; }
+
+template <typename P, typename Q>
+bool	_row_less( const P & lhs, const Q & rhs ) {
+	return (lhs.first < rhs.first) || (lhs.first == rhs.first && lhs.second < rhs.second);
+}
+
+template <typename F1, typename S1, typename F2, typename S2>
+bool	operator == ( const SoaReference<F1, S1> & lhs, const SoaReference<F2, S2> & rhs ) { return _row_equal(lhs, rhs); }
+
+template <typename F1, typename S1, typename F2, typename S2>
+bool	operator != ( const SoaReference<F1, S1> & lhs, const SoaReference<F2, S2> & rhs ) { return !_row_equal(lhs, rhs); }
+
+template <typename F1, typename S1, typename F2, typename S2>
+bool	operator < ( const SoaReference<F1, S1> & lhs, const SoaReference<F2, S2> & rhs ) { return _row_less(lhs, rhs); }
+
+template <typename F1, typename S1, typename F2, typename S2>
+bool	operator > ( const SoaReference<F1, S1> & lhs, const SoaReference<F2, S2> & rhs ) { return _row_less(rhs, lhs); }
+
+template <typename F1, typename S1, typename F2, typename S2>
+bool	operator <= ( const SoaReference<F1, S1> & lhs, const SoaReference<F2, S2> & rhs ) { return !_row_less(rhs, lhs); }
+
+template <typename F1, typename S1, typename F2, typename S2>
+bool	operator >= ( const SoaReference<F1, S1> & lhs, const SoaReference<F2, S2> & rhs ) { return !_row_less(lhs, rhs); }
+
+template <typename F, typename S, typename T1, typename T2>
+bool	operator == ( const SoaReference<F, S> & lhs, const pair<T1, T2> & rhs ) { return _row_equal(lhs, rhs); }
+
+template <typename F, typename S, typename T1, typename T2>
+bool	operator != ( const SoaReference<F, S> & lhs, const pair<T1, T2> & rhs ) { return !_row_equal(lhs, rhs); }
+
+template <typename F, typename S, typename T1, typename T2>
+bool	operator < ( const SoaReference<F, S> & lhs, const pair<T1, T2> & rhs ) { return _row_less(lhs, rhs); }
+
+template <typename F, typename S, typename T1, typename T2>
+bool	operator > ( const SoaReference<F, S> & lhs, const pair<T1, T2> & rhs ) { return _row_less(rhs, lhs); }
+
+template <typename F, typename S, typename T1, typename T2>
+bool	operator <= ( const SoaReference<F, S> & lhs, const pair<T1, T2> & rhs ) { return !_row_less(rhs, lhs); }
+
+template <typename F, typename S, typename T1, typename T2>
+bool	operator >= ( const SoaReference<F, S> & lhs, const pair<T1, T2> & rhs ) { return !_row_less(lhs, rhs); }
+
+template <typename T1, typename T2, typename F, typename S>
+bool	operator == ( const pair<T1, T2> & lhs, const SoaReference<F, S> & rhs ) { return _row_equal(lhs, rhs); }
+
+template <typename T1, typename T2, typename F, typename S>
+bool	operator != ( const pair<T1, T2> & lhs, const SoaReference<F, S> & rhs ) { return !_row_equal(lhs, rhs); }
+
+template <typename T1, typename T2, typename F, typename S>
+bool	operator < ( const pair<T1, T2> & lhs, const SoaReference<F, S> & rhs ) { return _row_less(lhs, rhs); }
+
+template <typename T1, typename T2, typename F, typename S>
+bool	operator > ( const pair<T1, T2> & lhs, const SoaReference<F, S> & rhs ) { return _row_less(rhs, lhs); }
+
+template <typename T1, typename T2, typename F, typename S>
+bool	operator <= ( const pair<T1, T2> & lhs, const SoaReference<F, S> & rhs ) { return !_row_less(rhs, lhs); }
+
+template <typename T1, typename T2, typename F, typename S>
+bool	operator >= ( const pair<T1, T2> & lhs, const SoaReference<F, S> & rhs ) { return !_row_less(lhs, rhs); }
+
+
+// ************************************************************************** //
+//                            SoaIterator template                            //
+// ************************************************************************** //
+
+/*
+**	Walks both columns of a soa_vector in step. operator-> hands out the
+**	proxy through a holder, so it->first and it->second work as with pairs.
+*/
+
+template <typename F, typename S>
+class SoaIterator {
+
+	typedef SoaIterator	type;
+
+public:
+	typedef random_access_iterator_tag			iterator_category;
+	typedef SoaReference<F, S>					reference;
+	typedef typename reference::value_type		value_type;
+	typedef ptrdiff_t							difference_type;
+
+	class pointer {
+
+	public:
+		explicit pointer( const reference & r ) : _r(r) { /* no-op */ }
+
+		reference *	operator -> ( void ) { return &_r; }
+
+	private:
+		reference	_r;
+
+	};
+
+	SoaIterator( F * first, S * second ) : _first(first), _second(second) { /* no-op */ }
+
+	/* Getters */
+	F *	first_base( void ) const { return _first; }
+	S *	second_base( void ) const { return _second; }
+
+	/* All iterators */
+	template <typename F2, typename S2>
+	SoaIterator( const SoaIterator<F2, S2> & src ) : _first(src.first_base()), _second(src.second_base()) { /* no-op */ }
+	SoaIterator( type const & src ) : _first(src._first), _second(src._second) { /* no-op */ }
+	~SoaIterator( void ) { /* no-op */ }
+	type &	operator = ( type const & rhs ) { _first = rhs._first; _second = rhs._second; return *this; }
+	type &	operator ++ ( void ) { ++_first; ++_second; return *this; }
+	type	operator ++ ( int ) { type tmp(*this); operator++(); return tmp; }
+
+	/* Input iterators */
+	pointer		operator -> ( void ) const { return pointer(**this); }
+
+	/* Output iterators */
+	reference	operator * ( void ) const { return reference(*_first, *_second); }
+
+	/* Forward iterators */
+	SoaIterator( void ) : _first(NULL), _second(NULL) { /* no-op */ }
+
+	/* Bidirectional iterators */
+	type &	operator -- ( void ) { --_first; --_second; return *this; }
+	type	operator -- ( int ) { type tmp(*this); operator--(); return tmp; }
+
+	/* Random Access iterators */
+	type	operator + ( difference_type n ) const { return type(_first + n, _second + n); }
+	type	operator - ( difference_type n ) const { return type(_first - n, _second - n); }
+
+	type &	operator += ( difference_type n ) { _first += n; _second += n; return *this; }
+	type &	operator -= ( difference_type n ) { _first -= n; _second -= n; return *this; }
+
+	reference	operator [] ( difference_type n ) const { return reference(_first[n], _second[n]); }
+
+private:
+	F *	_first;
+	S *	_second;
+
+};
+
+// Non-member operators, the first column stands for the position
+template <typename F1, typename S1, typename F2, typename S2>
+bool	operator == ( const SoaIterator<F1, S1> & lhs, const SoaIterator<F2, S2> & rhs ) {
+	return lhs.first_base() == rhs.first_base();
+}
+
+template <typename F1, typename S1, typename F2, typename S2>
+bool	operator != ( const SoaIterator<F1, S1> & lhs, const SoaIterator<F2, S2> & rhs ) {
+	return lhs.first_base() != rhs.first_base();
+}
+
+template <typename F1, typename S1, typename F2, typename S2>
+bool	operator < ( const SoaIterator<F1, S1> & lhs, const SoaIterator<F2, S2> & rhs ) {
+	return lhs.first_base() < rhs.first_base();
+}
+
+template <typename F1, typename S1, typename F2, typename S2>
+bool	operator <= ( const SoaIterator<F1, S1> & lhs, const SoaIterator<F2, S2> & rhs ) {
+	return lhs.first_base() <= rhs.first_base();
+}
+
+template <typename F1, typename S1, typename F2, typename S2>
+bool	operator > ( const SoaIterator<F1, S1> & lhs, const SoaIterator<F2, S2> & rhs ) {
+	return lhs.first_base() > rhs.first_base();
+}
+
+template <typename F1, typename S1, typename F2, typename S2>
+bool	operator >= ( const SoaIterator<F1, S1> & lhs, const SoaIterator<F2, S2> & rhs ) {
+	return lhs.first_base() >= rhs.first_base();
+}
+
+template <typename F1, typename S1, typename F2, typename S2>
+ptrdiff_t	operator - ( const SoaIterator<F1, S1> & lhs, const SoaIterator<F2, S2> & rhs ) {
+	return lhs.first_base() - rhs.first_base();
+}
+
+template <typename F, typename S>
+SoaIterator<F, S>	operator + ( ptrdiff_t n, const SoaIterator<F, S> & it ) { return it + n; }
+
+
+
+// ************************************************************************** //
+//                         SoaColumnIterator template                         //
+// ************************************************************************** //
+
+/*
+**	Walks one member of a range of pairs (or soa_vector rows): .first, or
+**	.second when Second is set. It lets a range go into a soa_vector column by
+**	column. The underlying iterator must give lvalues, as forward iterators do.
+*/
+
+template <typename Pair, bool Second>
+struct _soa_member {
+	typedef typename Pair::first_type	type;
+
+	template <typename P>
+	static const type &	get( const P & p ) { return p.first; }
+};
+
+template <typename Pair>
+struct _soa_member<Pair, true> {
+	typedef typename Pair::second_type	type;
+
+	template <typename P>
+	static const type &	get( const P & p ) { return p.second; }
+};
+
+template <typename Iterator, bool Second>
+class SoaColumnIterator {
+
+	typedef SoaColumnIterator											type;
+	typedef _soa_member<typename iterator_traits<Iterator>::value_type, Second>	member;
+
+public:
+	typedef typename _category<typename iterator_traits<Iterator>::iterator_category>::type	iterator_category;
+	typedef typename remove_const<typename member::type>::type		value_type;
+	typedef const value_type &										reference;
+	typedef const value_type *										pointer;
+	typedef typename iterator_traits<Iterator>::difference_type		difference_type;
+
+	explicit SoaColumnIterator( Iterator it ) : _it(it) { /* no-op */ }
+
+	/* Getters */
+	Iterator	base( void ) const { return _it; }
+
+	/* Forward iterators */
+	reference	operator * ( void ) const { return member::get(*_it); }
+	pointer		operator -> ( void ) const { return &**this; }
+	type &		operator ++ ( void ) { ++_it; return *this; }
+	type		operator ++ ( int ) { type tmp(*this); ++_it; return tmp; }
+
+	bool	operator == ( const type & rhs ) const { return _it == rhs._it; }
+	bool	operator != ( const type & rhs ) const { return _it != rhs._it; }
+
+	/* Bidirectional and random access iterators, when Iterator is one */
+	type &			operator -- ( void ) { --_it; return *this; }
+	type &			operator += ( difference_type n ) { _it += n; return *this; }
+	difference_type	operator - ( const type & rhs ) const { return _it - rhs._it; }
+
+private:
+	Iterator	_it;
+
+};
+
+}
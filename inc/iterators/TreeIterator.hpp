@@ -27,15 +27,16 @@ private:
 
 	typedef Node<value_type>						node_type;
 	typedef node_type *								node_pointer;
+	typedef NodeBase *								base_pointer;
 
-	node_pointer	_p;
+	base_pointer	_p;
 
 public:
 
-	explicit TreeIterator( node_pointer p ) : _p(p) { /* no-op */ }
+	explicit TreeIterator( base_pointer p ) : _p(p) { /* no-op */ }
 
 	/* Getters */
-	node_pointer	base( void ) const { return _p; }
+	base_pointer	base( void ) const { return _p; }
 
 	/*
 	**	Based on https://cplusplus.com/reference/iterator/
@@ -51,8 +52,8 @@ public:
 	/* Input iterators */
 	inline bool		operator == ( type const & rhs ) const { return _p == rhs.base(); }
 	inline bool		operator != ( type const & rhs ) const { return _p != rhs.base(); }
-	reference		operator * ( void ) const { return _p->data; }
-	pointer			operator -> ( void ) const { return &(_p->data); }
+	reference		operator * ( void ) const { return static_cast<node_pointer>(_p)->data; }
+	pointer			operator -> ( void ) const { return &static_cast<node_pointer>(_p)->data; }
 
 	/* Forward iterators */
 	TreeIterator( void ) : _p(NULL) { /* no-op */ }
@@ -87,15 +88,16 @@ private:
 
 	typedef Node<T>						node_type;
 	typedef node_type *					node_pointer;
+	typedef NodeBase *					base_pointer;
 
-	node_pointer	_p;
+	base_pointer	_p;
 
 public:
 
-	explicit TreeConstIterator( node_pointer p ) : _p(p) { /* no-op */ }
+	explicit TreeConstIterator( base_pointer p ) : _p(p) { /* no-op */ }
 
 	/* Getters */
-	node_pointer	base( void ) const { return _p; }
+	base_pointer	base( void ) const { return _p; }
 
 	/* All iterators */
 	TreeConstIterator( non_const_type const & src ) : _p(src.base()) { /* no-op */ }
@@ -108,8 +110,8 @@ public:
 	/* Input iterators */
 	inline bool		operator == ( type const & rhs ) const { return _p == rhs.base(); }
 	inline bool		operator != ( type const & rhs ) const { return _p != rhs.base(); }
-	reference		operator * ( void ) const { return _p->data; }
-	pointer			operator -> ( void ) const { return &(_p->data); }
+	reference		operator * ( void ) const { return static_cast<node_pointer>(_p)->data; }
+	pointer			operator -> ( void ) const { return &static_cast<node_pointer>(_p)->data; }
 
 	/* Forward iterators */
 	TreeConstIterator( void ) : _p(NULL) { /* no-op */ }
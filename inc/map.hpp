@@ -135,21 +135,14 @@ public:
 	/* Modifiers */
 	void	clear( void ) { tree.clear(); }
 
-	pair<iterator, bool>	insert( const_reference val ) {
-		if (has_key(val.first)) {
-			return ft::make_pair(--upper_bound(val.first), false);
-		}
-		return tree.insert(val);
-	} // single element
+	pair<iterator, bool>	insert( const_reference val ) { return tree.insert_unique(val); } // single element
 
 	template <typename InputIterator>
 	void		insert( InputIterator first, InputIterator last ) { while (first != last) insert(*first++); } // range
 
 	iterator	insert( iterator position, const_reference val ) {
-		if (has_key(val.first)) {
-			return --upper_bound(val.first);
-		}
-		return tree.insert(position, val);
+		(void)position;
+		return tree.insert_unique(val).first;
 	} // with hint
 
 	void		erase( iterator position ) { tree.erase(position); }
@@ -179,10 +172,6 @@ public:
 	key_compare		key_comp( void ) const { return compare; }
 	value_compare	value_comp( void ) const { return value_compare(key_comp()); }
 
-private:
-
-	bool	has_key( const_key_reference key ) const { return find(key) != end(); }
-
 };
 
 /* Non-member functions */
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring> // strerror
+#include <new> // placement new
+#include <stdexcept>
+#include <string>
+
+#include "iterators/RandomAccessIterator.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "growth.hpp"
+
+namespace ft {
+
+// ************************************************************************** //
+//                           mapped_vector template                           //
+// ************************************************************************** //
+
+/*
+**	A vector whose storage is a file mapped with mmap, so the elements survive
+**	the process and reopening the file costs no parsing nor copying.
+**
+**	The file holds the raw elements and nothing else: its length is size() *
+**	sizeof(T) whenever the vector is not open. While open, the file is grown
+**	to the capacity with ftruncate and remapped with mremap.
+**
+**	T must be trivially copyable, which is checked through
+**	is_trivially_relocatable (specialize it to opt a record type in). Elements
+**	are never destroyed.
+**
+**	In read_only mode the file is mapped with PROT_READ and every modifier
+**	throws std::logic_error.
+*/
+
+template<
+	typename T,
+	typename GrowthPolicy = ft::page_growth<4096>
+>
+class mapped_vector {
+
+	// Fails to compile for types that can't be written to a file as raw bytes
+	typedef char	_trivially_relocatable_check[is_trivially_relocatable<T>::value ? 1 : -1];
+
+public:
+	/* Member types */
+	typedef T													value_type;
+	typedef GrowthPolicy										growth_policy;
+	typedef value_type &										reference;
+	typedef const value_type &									const_reference;
+	typedef value_type *										pointer;
+	typedef const value_type *									const_pointer;
+	typedef RandomAccessIterator<value_type>					iterator;
+	typedef RandomAccessIterator<const value_type>				const_iterator;
+	typedef ft::reverse_iterator<iterator>						reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>				const_reverse_iterator;
+	typedef typename iterator_traits<iterator>::difference_type	difference_type;
+	typedef size_t												size_type;
+
+	enum mode { read_write, read_only };
+
+protected:
+	pointer	c;
+
+private:
+	/* Member variables */
+	size_type	_size;
+	size_type	_capacity;
+	int			_fd;
+	mode		_mode;
+	std::string	_path;
+
+	// Not copyable: two vectors would map and truncate the same file
+	mapped_vector( const mapped_vector & );
+	mapped_vector &	operator = ( const mapped_vector & );
+
+public:
+	/* Constructors */
+
+	// Opens (read_write: creates if needed) the file at path and maps its elements
+	explicit mapped_vector( const std::string & path, mode m = read_write )
+		: c(NULL), _size(0), _capacity(0), _fd(-1), _mode(m), _path(path) {
+		struct stat	st;
+
+		_fd = ::open(path.c_str(), m == read_only ? O_RDONLY : O_RDWR | O_CREAT, 0644);
+		if (_fd < 0) {
+			_syscall_error("open");
+		}
+		try {
+			if (::fstat(_fd, &st) < 0) {
+				_syscall_error("fstat");
+			}
+			if (st.st_size % sizeof(value_type)) {
+				throw std::runtime_error("mapped_vector: " + path + ": size is not a multiple of the element size");
+			}
+			_size = st.st_size / sizeof(value_type);
+			_map(_size);
+		} catch (...) {
+			_close();
+			throw;
+		}
+	}
+
+	/* Destructor */
+	~mapped_vector( void ) {
+		if (c) {
+			::munmap(c, _capacity * sizeof(value_type));
+		}
+		if (_mode == read_write) {
+			(void)::ftruncate(_fd, _size * sizeof(value_type)); // drop the unused capacity
+		}
+		_close();
+	}
+
+	/* Iterators */
+	iterator			begin( void ) { return iterator(c); }
+	const_iterator		begin( void ) const { return const_iterator(c); }
+	iterator			end( void ) { return iterator(c + _size); }
+	const_iterator		end( void ) const { return const_iterator(c + _size); }
+	reverse_iterator		rbegin( void ) { return reverse_iterator(end()); }
+	const_reverse_iterator	rbegin( void ) const { return const_reverse_iterator(end()); }
+	reverse_iterator		rend( void ) { return reverse_iterator(begin()); }
+	const_reverse_iterator	rend( void ) const { return const_reverse_iterator(begin()); }
+
+	/* Capacity */
+	size_type	size( void ) const { return _size; }
+	size_type	max_size( void ) const { return static_cast<size_type>(-1) / 2 / sizeof(value_type); }
+	size_type	capacity( void ) const { return _capacity; }
+	bool		empty( void ) const { return !_size; }
+
+	void	resize( size_type n, value_type val = value_type() ) {
+		_check_writable();
+		if (n > _capacity) {
+			_remap(_grow(n - _size));
+		}
+		for (; _size < n; _size++) {
+			new (c + _size) value_type(val);
+		}
+		_size = n;
+	}
+
+	void	reserve( size_type n ) {
+		_check_writable();
+		if (n > max_size()) {
+			throw std::length_error("mapped_vector::reserve");
+		}
+		if (n > _capacity) {
+			_remap(n);
+		}
+	}
+
+	/* Element access */
+	reference			operator [] ( size_type n ) { return c[n]; }
+	const_reference		operator [] ( size_type n ) const { return c[n]; }
+	reference			at( size_type n ) { if (n >= _size) throw std::out_of_range("mapped_vector::at"); return c[n]; }
+	const_reference		at( size_type n ) const { if (n >= _size) throw std::out_of_range("mapped_vector::at"); return c[n]; }
+	reference			front( void ) { return c[0]; }
+	const_reference		front( void ) const { return c[0]; }
+	reference			back( void ) { return c[_size - 1]; }
+	const_reference		back( void ) const { return c[_size - 1]; }
+	value_type *		data( void ) { return c; }
+	const value_type *	data( void ) const { return c; }
+
+	/* Modifiers */
+	void	push_back( const value_type & val ) {
+		_check_writable();
+		if (_capacity == _size) {
+			const value_type	copy(val); // val may be one of the elements
+
+			_remap(_grow(1));
+			new (c + _size) value_type(copy);
+		} else {
+			new (c + _size) value_type(val);
+		}
+		_size++;
+	}
+
+	void	pop_back( void ) { _check_writable(); if (_size > 0) _size--; }
+
+	void	clear( void ) { _check_writable(); _size = 0; }
+
+	/* Mapping */
+	bool				is_read_only( void ) const { return _mode == read_only; }
+	const std::string &	path( void ) const { return _path; }
+
+	// Writes the dirty pages back to the file
+	void	flush( void ) {
+		if (c && _mode == read_write && ::msync(c, _capacity * sizeof(value_type), MS_SYNC) < 0) {
+			_syscall_error("msync");
+		}
+	}
+
+private:
+
+	// capacity needed to hold n more elements
+	size_type	_grow( size_type n ) const {
+		return growth_policy::grow(_size, _size + n, max_size(), sizeof(value_type));
+	}
+
+	void	_check_writable( void ) const {
+		if (_mode == read_only) {
+			throw std::logic_error("mapped_vector: " + _path + " is read only");
+		}
+	}
+
+	void	_map( size_type capacity ) {
+		if (capacity == 0) {
+			return ;
+		}
+
+		int		prot = _mode == read_only ? PROT_READ : PROT_READ | PROT_WRITE;
+		void *	p = ::mmap(NULL, capacity * sizeof(value_type), prot, MAP_SHARED, _fd, 0);
+
+		if (p == MAP_FAILED) {
+			_syscall_error("mmap");
+		}
+		c = static_cast<pointer>(p);
+		_capacity = capacity;
+	}
+
+	// Grows the file to the new capacity and maps it, moving the mapping if needed
+	void	_remap( size_type capacity ) {
+		if (::ftruncate(_fd, capacity * sizeof(value_type)) < 0) {
+			_syscall_error("ftruncate");
+		}
+		if (!c) {
+			_map(capacity);
+			return ;
+		}
+#if defined(DARWIN)
+		// no mremap, the file keeps the elements while nothing is mapped
+		::munmap(c, _capacity * sizeof(value_type));
+		c = NULL;
+		_map(capacity);
+#else
+		void *	p = ::mremap(c, _capacity * sizeof(value_type), capacity * sizeof(value_type), MREMAP_MAYMOVE);
+
+		if (p == MAP_FAILED) {
+			_syscall_error("mremap");
+		}
+		c = static_cast<pointer>(p);
+		_capacity = capacity;
+#endif
+	}
+
+	void	_close( void ) {
+		if (_fd >= 0) {
+			::close(_fd);
+			_fd = -1;
+		}
+	}
+
+	void	_syscall_error( const char * call ) const {
+		throw std::runtime_error(std::string("mapped_vector: ") + call + " " + _path + ": " + std::strerror(errno));
+	}
+
+};
+
+}
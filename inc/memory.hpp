@@ -0,0 +1,309 @@
+#pragma once
+
+#include <cstring> // memcpy, memmove
+#include <utility> // move
+
+#include "type_traits.hpp"
+#include "algorithm.hpp"
+
+namespace ft {
+
+// ************************************************************************** //
+//                               relocation                                   //
+// ************************************************************************** //
+
+/*
+**	Relocation moves objects from one block of raw memory to another: the
+**	destination is uninitialized before the call, the source is uninitialized
+**	after it.
+**
+**	1. trivially relocatable types: a single memcpy
+**	2. C++11 and later: move construct, then destroy the source
+**	3. swap relocatable types: default construct, swap, then destroy the source
+**	4. everything else: copy construct, then destroy the source
+**
+**	Sources are only destroyed once every element has its new place. If one of
+**	them throws, the elements already placed go back (or their copies are
+**	destroyed) and the source range is left as it was. uninitialized_relocate_gap
+**	does the same in one pass while leaving room for an insertion.
+*/
+
+template <typename T, typename Allocator>
+void	_place_one( T * dest, T * src, Allocator & alloc, true_type ) {
+	alloc.construct(dest, T());
+	dest->swap(*src);
+} // swap
+
+template <typename T, typename Allocator>
+void	_place_one( T * dest, T * src, Allocator & alloc, false_type ) {
+#if __cplusplus >= 201103L
+	alloc.construct(dest, std::move(*src));
+#else
+	alloc.construct(dest, *src);
+#endif
+} // move or copy
+
+template <typename T, typename Allocator>
+void	_unplace_one( T * dest, T * src, Allocator & alloc, true_type ) {
+	dest->swap(*src);
+	alloc.destroy(dest);
+} // swap back
+
+template <typename T, typename Allocator>
+void	_unplace_one( T * dest, T *, Allocator & alloc, false_type ) {
+	alloc.destroy(dest);
+} // the source still holds the value
+
+// Where the element at index i goes when a gap of n slots is left at index j
+inline size_t	_gap_index( size_t i, size_t j, size_t n ) { return i < j ? i : i + n; }
+
+template <typename T, typename Allocator>
+void	_relocate( T * first, T * last, T * dest, size_t j, size_t n, Allocator &, true_type ) {
+	size_t	size = last - first;
+
+	if (j) {
+		std::memcpy(static_cast<void *>(dest), static_cast<void *>(first), j * sizeof(T));
+	}
+	if (size - j) {
+		std::memcpy(static_cast<void *>(dest + j + n), static_cast<void *>(first + j), (size - j) * sizeof(T));
+	}
+} // trivial
+
+template <typename T, typename Allocator>
+void	_relocate( T * first, T * last, T * dest, size_t j, size_t n, Allocator & alloc, false_type ) {
+#if __cplusplus >= 201103L
+	typedef false_type	swap_type;
+#else
+	typedef integral_constant<bool, is_swap_relocatable<T>::value>	swap_type;
+#endif
+	size_t	i = 0;
+
+	try {
+		for (; first + i != last; i++) {
+			_place_one(dest + _gap_index(i, j, n), first + i, alloc, swap_type());
+		}
+	} catch (...) {
+		while (i--) {
+			_unplace_one(dest + _gap_index(i, j, n), first + i, alloc, swap_type());
+		}
+		throw;
+	}
+	for (; first != last; ++first) {
+		alloc.destroy(first);
+	}
+} // element wise
+
+template <typename T, typename Allocator>
+void	uninitialized_relocate( T * first, T * last, T * dest, Allocator & alloc ) {
+	typedef integral_constant<bool, is_trivially_relocatable<T>::value>	trivial_type;
+
+	_relocate(first, last, dest, last - first, 0, alloc, trivial_type());
+}
+
+// Same, leaving n uninitialized slots at dest + j
+template <typename T, typename Allocator>
+void	uninitialized_relocate_gap( T * first, T * last, T * dest, size_t j, size_t n, Allocator & alloc ) {
+	typedef integral_constant<bool, is_trivially_relocatable<T>::value>	trivial_type;
+
+	_relocate(first, last, dest, j, n, alloc, trivial_type());
+}
+
+/*
+**	Allocators that can resize a block in place (or move it without copying
+**	bytes) provide `pointer reallocate(pointer p, size_type old_n, size_type
+**	new_n)` and specialize this trait. p may be NULL and new_n may be 0.
+**	Containers only use it for trivially relocatable elements.
+*/
+template <typename Allocator>
+struct allocator_can_reallocate : false_type {};
+
+/*
+**	Alignment in bytes guaranteed by an allocator beyond the fundamental one,
+**	0 if it makes no such promise.
+*/
+template <typename Allocator>
+struct allocator_alignment : integral_constant<size_t, 0> {};
+
+/*
+**	Allocators that can free everything they handed out in one go provide
+**	`void release()` and specialize this trait. Containers call it once all
+**	their elements are destroyed, instead of deallocating them one by one.
+*/
+template <typename Allocator>
+struct allocator_can_release : false_type {};
+
+/*
+**	Exchanges the allocators of two containers swapping their storage.
+**	Allocators owning their memory overload it to swap that memory too, a
+**	copy would leave it behind.
+*/
+template <typename Allocator>
+void	swap_allocators( Allocator & a, Allocator & b ) {
+	Allocator	tmp(a);
+
+	a = b;
+	b = tmp;
+}
+
+
+// ************************************************************************** //
+//                           uninitialized fill                               //
+// ************************************************************************** //
+
+/*
+**	Constructs n copies of val (or n value initialized objects) in raw memory.
+**	Scalars need no construction and go through ft::fill_n. If a copy throws,
+**	the objects already built are destroyed before the exception goes on.
+*/
+
+// Destroys [first, last), scalars need nothing
+template <typename T, typename Allocator>
+void	destroy( T * first, T * last, Allocator & alloc ) {
+	if (is_scalar<T>::value) {
+		return ;
+	}
+	for (; first != last; ++first) {
+		alloc.destroy(first);
+	}
+}
+
+template <typename T, typename Allocator>
+void	_uninitialized_fill_n( T * first, size_t n, const T & val, Allocator &, true_type ) {
+	ft::fill_n(first, n, val);
+} // scalar
+
+template <typename T, typename Allocator>
+void	_uninitialized_fill_n( T * first, size_t n, const T & val, Allocator & alloc, false_type ) {
+	T *	cur = first;
+
+	try {
+		for (T * last = first + n; cur != last; ++cur) {
+			alloc.construct(cur, val);
+		}
+	} catch (...) {
+		ft::destroy(first, cur, alloc);
+		throw;
+	}
+} // element wise
+
+template <typename T, typename Allocator>
+void	uninitialized_fill_n( T * first, size_t n, const T & val, Allocator & alloc ) {
+	_uninitialized_fill_n(first, n, val, alloc, integral_constant<bool, is_scalar<T>::value>());
+}
+
+template <typename T, typename Allocator>
+void	uninitialized_fill( T * first, T * last, const T & val, Allocator & alloc ) {
+	ft::uninitialized_fill_n(first, last - first, val, alloc);
+}
+
+// Leaves scalars uninitialized, value initializes everything else
+template <typename T, typename Allocator>
+void	uninitialized_default_n( T * first, size_t n, Allocator & alloc ) {
+	if (is_scalar<T>::value) {
+		return ;
+	}
+	_uninitialized_fill_n(first, n, T(), alloc, false_type());
+}
+
+
+// ************************************************************************** //
+//                           uninitialized copy                               //
+// ************************************************************************** //
+
+/*
+**	Copy constructs [first, last) into raw memory at dest and returns the end
+**	of the new range. Contiguous ranges of the same scalar type need no
+**	construction and go through ft::copy. Like uninitialized_fill_n, all or
+**	nothing.
+*/
+
+template <typename InputIterator, typename T, typename Allocator>
+T *	_uninitialized_copy( InputIterator first, InputIterator last, T * dest, Allocator & alloc, false_type ) {
+	T *	cur = dest;
+
+	try {
+		for (; first != last; ++first, ++cur) {
+			alloc.construct(cur, *first);
+		}
+	} catch (...) {
+		ft::destroy(dest, cur, alloc);
+		throw;
+	}
+	return cur;
+} // element wise
+
+template <typename U, typename T, typename Allocator>
+T *	_uninitialized_copy( U * first, U * last, T * dest, Allocator &, true_type ) {
+	return ft::copy(first, last, dest);
+} // scalar
+
+template <typename InputIterator, typename T, typename Allocator>
+T *	uninitialized_copy( InputIterator first, InputIterator last, T * dest, Allocator & alloc ) {
+	return _uninitialized_copy(_unwrap(first), _unwrap(last), dest, alloc, _bitwise_copyable(_unwrap(first), dest));
+}
+
+
+// ************************************************************************** //
+//                                  gaps                                      //
+// ************************************************************************** //
+
+/*
+**	In place shifting of the live range [pos, last) inside a buffer that has
+**	room for n more elements.
+**
+**	open_gap moves the range n slots to the right and returns where the
+**	uninitialized part of the gap [pos, pos + n) starts: slots before it still
+**	hold live objects and must be assigned, the others constructed. If it
+**	throws, nothing past last is left alive.
+**
+**	close_gap destroys [pos, pos + n) and pulls the rest of the range over it.
+**
+**	Trivially relocatable types shift with a single memmove, other types with
+**	ft::move_backward / ft::move, constructing or destroying only what crosses
+**	`last`.
+*/
+
+template <typename T, typename Allocator>
+T *	_open_gap( T * pos, T * last, size_t n, Allocator &, true_type ) {
+	std::memmove(static_cast<void *>(pos + n), static_cast<void *>(pos), (last - pos) * sizeof(T));
+	return pos;
+} // trivially relocatable
+
+template <typename T, typename Allocator>
+T *	_open_gap( T * pos, T * last, size_t n, Allocator & alloc, false_type ) {
+	if (static_cast<size_t>(last - pos) <= n) {
+		ft::uninitialized_copy(pos, last, pos + n, alloc);
+	} else {
+		ft::uninitialized_copy(last - n, last, last, alloc);
+		try {
+			ft::move_backward(pos, last - n, last);
+		} catch (...) {
+			ft::destroy(last, last + n, alloc);
+			throw;
+		}
+	}
+	return last;
+} // by assignment
+
+template <typename T, typename Allocator>
+T *	open_gap( T * pos, T * last, size_t n, Allocator & alloc ) {
+	return _open_gap(pos, last, n, alloc, integral_constant<bool, is_trivially_relocatable<T>::value>());
+}
+
+template <typename T, typename Allocator>
+void	_close_gap( T * pos, T * last, size_t n, Allocator & alloc, true_type ) {
+	ft::destroy(pos, pos + n, alloc);
+	std::memmove(static_cast<void *>(pos), static_cast<void *>(pos + n), (last - pos - n) * sizeof(T));
+} // trivially relocatable
+
+template <typename T, typename Allocator>
+void	_close_gap( T * pos, T * last, size_t n, Allocator & alloc, false_type ) {
+	ft::destroy(ft::move(pos + n, last, pos), last, alloc);
+} // by assignment
+
+template <typename T, typename Allocator>
+void	close_gap( T * pos, T * last, size_t n, Allocator & alloc ) {
+	_close_gap(pos, last, n, alloc, integral_constant<bool, is_trivially_relocatable<T>::value>());
+}
+
+}
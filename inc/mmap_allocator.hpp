@@ -0,0 +1,135 @@
+#pragma once
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cstddef> // ptrdiff_t
+#include <cstring> // memcpy
+#include <new> // bad_alloc, placement new
+
+#include "memory.hpp"
+
+namespace ft {
+
+// ************************************************************************** //
+//                            mmap_allocator template                         //
+// ************************************************************************** //
+
+/*
+**	Allocates every block with its own anonymous mmap, rounded up to whole
+**	pages, so it is only worth it for large buffers.
+**
+**	The reallocate extension grows (or shrinks) a block with
+**	mremap(MREMAP_MAYMOVE): the kernel moves page table entries instead of
+**	copying bytes. Containers detect it through allocator_can_reallocate and
+**	use it for trivially relocatable elements.
+**
+**	On Darwin there is no mremap and reallocate falls back to a copy.
+*/
+
+template <typename T>
+class mmap_allocator {
+
+public:
+	/* Member types */
+	typedef T				value_type;
+	typedef T *				pointer;
+	typedef const T *		const_pointer;
+	typedef T &				reference;
+	typedef const T &		const_reference;
+	typedef size_t			size_type;
+	typedef ptrdiff_t		difference_type;
+
+	template <typename U>
+	struct rebind { typedef mmap_allocator<U> other; };
+
+	/* Constructors */
+	mmap_allocator( void ) { /* no-op */ }
+	mmap_allocator( const mmap_allocator & ) { /* no-op */ }
+	template <typename U>
+	mmap_allocator( const mmap_allocator<U> & ) { /* no-op */ }
+	~mmap_allocator( void ) { /* no-op */ }
+
+	pointer			address( reference x ) const { return &x; }
+	const_pointer	address( const_reference x ) const { return &x; }
+	size_type		max_size( void ) const { return static_cast<size_type>(-1) / sizeof(T); }
+
+	pointer	allocate( size_type n, const void * hint = 0 ) {
+		(void)hint;
+		if (n == 0) {
+			return NULL;
+		}
+		if (n > max_size()) {
+			throw std::bad_alloc();
+		}
+
+		void *	p = ::mmap(NULL, _bytes(n), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+		if (p == MAP_FAILED) {
+			throw std::bad_alloc();
+		}
+		return static_cast<pointer>(p);
+	}
+
+	void	deallocate( pointer p, size_type n ) {
+		if (p) {
+			::munmap(p, _bytes(n));
+		}
+	}
+
+	// Resizes a block of old_n elements to new_n, keeping the bytes of the first min(old_n, new_n)
+	pointer	reallocate( pointer p, size_type old_n, size_type new_n ) {
+		if (!p || !new_n) {
+			pointer	tmp = allocate(new_n);
+
+			deallocate(p, old_n);
+			return tmp;
+		}
+		if (new_n > max_size()) {
+			throw std::bad_alloc();
+		}
+		if (_bytes(old_n) == _bytes(new_n)) {
+			return p;
+		}
+#if defined(DARWIN)
+		pointer	tmp = allocate(new_n);
+
+		std::memcpy(static_cast<void *>(tmp), static_cast<void *>(p), (old_n < new_n ? old_n : new_n) * sizeof(T));
+		deallocate(p, old_n);
+		return tmp;
+#else
+		void *	tmp = ::mremap(p, _bytes(old_n), _bytes(new_n), MREMAP_MAYMOVE);
+
+		if (tmp == MAP_FAILED) {
+			throw std::bad_alloc();
+		}
+		return static_cast<pointer>(tmp);
+#endif
+	}
+
+	void	construct( pointer p, const_reference val ) { new (static_cast<void *>(p)) T(val); }
+	void	destroy( pointer p ) { p->~T(); }
+
+private:
+
+	// n elements rounded up to whole pages
+	static size_type	_bytes( size_type n ) {
+		size_type	page = static_cast<size_type>(::sysconf(_SC_PAGESIZE));
+
+		return (n * sizeof(T) + page - 1) / page * page;
+	}
+
+};
+
+/* Non-member functions */
+
+// Stateless: any two instances can free each other's blocks
+template <typename T, typename U>
+bool	operator == ( const mmap_allocator<T> &, const mmap_allocator<U> & ) { return true; }
+
+template <typename T, typename U>
+bool	operator != ( const mmap_allocator<T> &, const mmap_allocator<U> & ) { return false; }
+
+template <typename T>
+struct allocator_can_reallocate< mmap_allocator<T> > : true_type {};
+
+}
@@ -0,0 +1,466 @@
+#pragma once
+
+#include <cstddef> // size_t
+#include <functional> // plus
+#include <memory> // allocator
+
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "algorithm.hpp"
+#include "memory.hpp"
+#include "sort.hpp"
+#include "vector.hpp"
+#include "thread_pool.hpp"
+
+namespace ft {
+
+namespace parallel {
+
+// ************************************************************************** //
+//                                   policy                                   //
+// ************************************************************************** //
+
+/*
+**	How an algorithm splits its range: `grain` elements per task (0 for
+**	chunks of about 64 KB, which stay in L2 while they are worked on), on
+**	`pool` (NULL for thread_pool::shared()). Ranges shorter than
+**	`serial_threshold` elements (0 for two grains), or a pool of one thread,
+**	run serially on the calling thread.
+*/
+
+struct policy {
+	size_t			grain;
+	size_t			serial_threshold;
+	thread_pool *	pool;
+
+	explicit policy( size_t grain = 0, size_t serial_threshold = 0, thread_pool * pool = NULL )
+		: grain(grain), serial_threshold(serial_threshold), pool(pool) { /* no-op */ }
+};
+
+enum { _chunk_bytes = 64 * 1024 };
+
+/*
+**	A range cut into count chunks of grain elements, the last one shorter.
+**	serial is set when the range isn't worth sending to the pool. Only
+**	ranges that are split look at the pool: a short one never starts the
+**	shared pool's threads.
+*/
+template <typename RandomAccessIterator>
+struct _chunks {
+	typedef typename iterator_traits<RandomAccessIterator>::difference_type	difference_type;
+	typedef typename iterator_traits<RandomAccessIterator>::value_type		value_type;
+
+	thread_pool *	pool; // NULL when serial
+	difference_type	n;
+	difference_type	grain;
+	size_t			count;
+	bool			serial;
+
+	_chunks( RandomAccessIterator first, RandomAccessIterator last, const policy & p )
+		: pool(NULL), n(last - first) {
+		size_t	g = p.grain ? p.grain : (sizeof(value_type) < _chunk_bytes ? _chunk_bytes / sizeof(value_type) : 1);
+		size_t	threshold = p.serial_threshold ? p.serial_threshold : 2 * g;
+
+		grain = static_cast<difference_type>(g);
+		count = n > 0 ? static_cast<size_t>((n + grain - 1) / grain) : 0;
+		serial = count < 2 || static_cast<size_t>(n) < threshold;
+		if (!serial) {
+			pool = p.pool ? p.pool : &thread_pool::shared();
+			serial = pool->size() < 2;
+		}
+	}
+
+	difference_type	begin( size_t i ) const { return static_cast<difference_type>(i) * grain; }
+	difference_type	end( size_t i ) const { return i + 1 < count ? begin(i + 1) : n; }
+};
+
+
+// ************************************************************************** //
+//                                  for_each                                  //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/algorithm/for_each
+**
+**	Every chunk gets its own copy of f, so f must not count on seeing the
+**	whole range.
+*/
+
+template <typename RandomAccessIterator, typename Function>
+struct _for_each_task {
+	RandomAccessIterator					first;
+	Function								f;
+	const _chunks<RandomAccessIterator> &	chunks;
+
+	static void	run( void * context, size_t i ) {
+		_for_each_task &	self = *static_cast<_for_each_task *>(context);
+		Function			f = self.f;
+		RandomAccessIterator	last = self.first + self.chunks.end(i);
+
+		for (RandomAccessIterator it = self.first + self.chunks.begin(i); it != last; ++it) {
+			f(*it);
+		}
+	}
+};
+
+template <typename RandomAccessIterator, typename Function>
+void	for_each( RandomAccessIterator first, RandomAccessIterator last, Function f, const policy & p = policy() ) {
+	_chunks<RandomAccessIterator>	chunks(first, last, p);
+
+	if (chunks.serial) {
+		for (; first != last; ++first) {
+			f(*first);
+		}
+		return ;
+	}
+	_for_each_task<RandomAccessIterator, Function>	task = { first, f, chunks };
+
+	chunks.pool->run(&task.run, &task, chunks.count);
+}
+
+
+// ************************************************************************** //
+//                                 transform                                  //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/algorithm/transform
+**
+**	dest must be random access too. It may be first, but must not overlap the
+**	range otherwise.
+*/
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename UnaryOperation>
+struct _transform_task {
+	RandomAccessIterator1					first;
+	RandomAccessIterator2					dest;
+	UnaryOperation							op;
+	const _chunks<RandomAccessIterator1> &	chunks;
+
+	static void	run( void * context, size_t i ) {
+		_transform_task &		self = *static_cast<_transform_task *>(context);
+		UnaryOperation			op = self.op;
+		RandomAccessIterator1	it = self.first + self.chunks.begin(i);
+		RandomAccessIterator1	last = self.first + self.chunks.end(i);
+		RandomAccessIterator2	dest = self.dest + self.chunks.begin(i);
+
+		for (; it != last; ++it, ++dest) {
+			*dest = op(*it);
+		}
+	}
+};
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename UnaryOperation>
+RandomAccessIterator2	transform( RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 dest,
+	UnaryOperation op, const policy & p = policy() ) {
+	_chunks<RandomAccessIterator1>	chunks(first, last, p);
+
+	if (chunks.serial) {
+		for (; first != last; ++first, ++dest) {
+			*dest = op(*first);
+		}
+		return dest;
+	}
+	_transform_task<RandomAccessIterator1, RandomAccessIterator2, UnaryOperation>	task = { first, dest, op, chunks };
+
+	chunks.pool->run(&task.run, &task, chunks.count);
+	return dest + chunks.n;
+}
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename RandomAccessIterator3,
+	typename BinaryOperation>
+struct _transform2_task {
+	RandomAccessIterator1					first1;
+	RandomAccessIterator2					first2;
+	RandomAccessIterator3					dest;
+	BinaryOperation							op;
+	const _chunks<RandomAccessIterator1> &	chunks;
+
+	static void	run( void * context, size_t i ) {
+		_transform2_task &		self = *static_cast<_transform2_task *>(context);
+		BinaryOperation			op = self.op;
+		RandomAccessIterator1	it1 = self.first1 + self.chunks.begin(i);
+		RandomAccessIterator1	last1 = self.first1 + self.chunks.end(i);
+		RandomAccessIterator2	it2 = self.first2 + self.chunks.begin(i);
+		RandomAccessIterator3	dest = self.dest + self.chunks.begin(i);
+
+		for (; it1 != last1; ++it1, ++it2, ++dest) {
+			*dest = op(*it1, *it2);
+		}
+	}
+};
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename RandomAccessIterator3,
+	typename BinaryOperation>
+RandomAccessIterator3	transform( RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+	RandomAccessIterator2 first2, RandomAccessIterator3 dest, BinaryOperation op, const policy & p = policy() ) {
+	_chunks<RandomAccessIterator1>	chunks(first1, last1, p);
+
+	if (chunks.serial) {
+		for (; first1 != last1; ++first1, ++first2, ++dest) {
+			*dest = op(*first1, *first2);
+		}
+		return dest;
+	}
+	_transform2_task<RandomAccessIterator1, RandomAccessIterator2, RandomAccessIterator3, BinaryOperation>
+		task = { first1, first2, dest, op, chunks };
+
+	chunks.pool->run(&task.run, &task, chunks.count);
+	return dest + chunks.n;
+}
+
+
+// ************************************************************************** //
+//                                   reduce                                   //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/algorithm/reduce
+**
+**	Every chunk is folded on its own, then the partial results are folded in
+**	chunk order into init: op must be associative. The grouping only depends
+**	on the grain, so floating point sums don't change from one run to the
+**	next, but they can differ from a serial sum.
+*/
+
+template <typename RandomAccessIterator, typename T, typename BinaryOperation>
+T	_fold( RandomAccessIterator first, RandomAccessIterator last, T init, BinaryOperation op ) {
+	for (; first != last; ++first) {
+		init = op(init, *first);
+	}
+	return init;
+}
+
+template <typename RandomAccessIterator, typename T, typename BinaryOperation>
+struct _reduce_task {
+	RandomAccessIterator					first;
+	BinaryOperation							op;
+	const _chunks<RandomAccessIterator> &	chunks;
+	ft::vector<T> &							partials;
+
+	static void	run( void * context, size_t i ) {
+		_reduce_task &			self = *static_cast<_reduce_task *>(context);
+		RandomAccessIterator	it = self.first + self.chunks.begin(i);
+		RandomAccessIterator	last = self.first + self.chunks.end(i);
+		T						partial = *it;
+
+		self.partials[i] = _fold(++it, last, partial, self.op);
+	}
+};
+
+template <typename RandomAccessIterator, typename T, typename BinaryOperation>
+T	reduce( RandomAccessIterator first, RandomAccessIterator last, T init, BinaryOperation op,
+	const policy & p = policy() ) {
+	_chunks<RandomAccessIterator>	chunks(first, last, p);
+
+	if (chunks.serial) {
+		return _fold(first, last, init, op);
+	}
+	ft::vector<T>										partials(chunks.count, init);
+	_reduce_task<RandomAccessIterator, T, BinaryOperation>	task = { first, op, chunks, partials };
+
+	chunks.pool->run(&task.run, &task, chunks.count);
+	return _fold(partials.begin(), partials.end(), init, op);
+}
+
+template <typename RandomAccessIterator, typename T>
+T	reduce( RandomAccessIterator first, RandomAccessIterator last, T init, const policy & p = policy() ) {
+	return ft::parallel::reduce(first, last, init, std::plus<T>(), p);
+}
+
+
+// ************************************************************************** //
+//                               inclusive_scan                               //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/algorithm/inclusive_scan
+**
+**	Two passes over the chunks: the first reduces every chunk, a serial scan
+**	of those sums gives each chunk the total of the chunks before it, and the
+**	second pass scans every chunk from there. dest may be first.
+*/
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename BinaryOperation>
+struct _scan_task {
+	typedef typename remove_const<typename iterator_traits<RandomAccessIterator1>::value_type>::type	value_type;
+
+	RandomAccessIterator1					first;
+	RandomAccessIterator2					dest;
+	BinaryOperation							op;
+	const _chunks<RandomAccessIterator1> &	chunks;
+	ft::vector<value_type> &				offsets; // total of the chunks before each one
+
+	static void	reduce( void * context, size_t i ) {
+		_scan_task &			self = *static_cast<_scan_task *>(context);
+		RandomAccessIterator1	it = self.first + self.chunks.begin(i);
+		RandomAccessIterator1	last = self.first + self.chunks.end(i);
+		value_type				partial = *it;
+
+		self.offsets[i] = _fold(++it, last, partial, self.op);
+	}
+
+	static void	scan( void * context, size_t i ) {
+		_scan_task &			self = *static_cast<_scan_task *>(context);
+		RandomAccessIterator1	it = self.first + self.chunks.begin(i);
+		RandomAccessIterator1	last = self.first + self.chunks.end(i);
+		RandomAccessIterator2	dest = self.dest + self.chunks.begin(i);
+		value_type				sum = i ? self.op(self.offsets[i - 1], *it) : *it;
+
+		for (*dest = sum; ++it != last; ) {
+			sum = self.op(sum, *it);
+			*++dest = sum;
+		}
+	}
+};
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename BinaryOperation>
+RandomAccessIterator2	inclusive_scan( RandomAccessIterator1 first, RandomAccessIterator1 last,
+	RandomAccessIterator2 dest, BinaryOperation op, const policy & p = policy() ) {
+	typedef typename remove_const<typename iterator_traits<RandomAccessIterator1>::value_type>::type	value_type;
+
+	_chunks<RandomAccessIterator1>	chunks(first, last, p);
+
+	if (chunks.serial) {
+		if (first == last) {
+			return dest;
+		}
+		value_type	sum = *first;
+
+		for (*dest = sum; ++first != last; ) {
+			sum = op(sum, *first);
+			*++dest = sum;
+		}
+		return ++dest;
+	}
+	ft::vector<value_type>													offsets(chunks.count, *first);
+	_scan_task<RandomAccessIterator1, RandomAccessIterator2, BinaryOperation>	task = { first, dest, op, chunks, offsets };
+
+	chunks.pool->run(&task.reduce, &task, chunks.count);
+	for (size_t i = 1; i < chunks.count; i++) {
+		offsets[i] = op(offsets[i - 1], offsets[i]);
+	}
+	chunks.pool->run(&task.scan, &task, chunks.count);
+	return dest + chunks.n;
+}
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+RandomAccessIterator2	inclusive_scan( RandomAccessIterator1 first, RandomAccessIterator1 last,
+	RandomAccessIterator2 dest, const policy & p = policy() ) {
+	typedef typename remove_const<typename iterator_traits<RandomAccessIterator1>::value_type>::type	value_type;
+
+	return ft::parallel::inclusive_scan(first, last, dest, std::plus<value_type>(), p);
+}
+
+
+// ************************************************************************** //
+//                                    sort                                    //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/algorithm/sort
+**
+**	The range is cut into a power of two runs, at least one per thread, each
+**	sorted with ft::sort. Pairs of runs are then merged in parallel, back and
+**	forth between the range and a buffer, halving the number of runs every
+**	round. Not stable, like ft::sort.
+*/
+
+template <typename RandomAccessIterator, typename Compare>
+struct _sort_task {
+	typedef typename iterator_traits<RandomAccessIterator>::difference_type	difference_type;
+	typedef typename iterator_traits<RandomAccessIterator>::value_type		value_type;
+
+	RandomAccessIterator	first;
+	value_type *			buffer;
+	Compare					comp;
+	difference_type			n;
+	size_t					runs;
+	size_t					width; // runs merged into one this round
+	bool					to_buffer;
+
+	difference_type	bound( size_t run ) const { return static_cast<difference_type>(n * run / runs); }
+
+	static void	sort( void * context, size_t i ) {
+		_sort_task &	self = *static_cast<_sort_task *>(context);
+
+		ft::sort(self.first + self.bound(i), self.first + self.bound(i + 1), self.comp);
+	}
+
+	static void	merge( void * context, size_t i ) {
+		_sort_task &	self = *static_cast<_sort_task *>(context);
+		difference_type	lo = self.bound(i * self.width);
+		difference_type	mid = self.bound(i * self.width + self.width / 2);
+		difference_type	hi = self.bound(i * self.width + self.width);
+
+		if (self.to_buffer) {
+			_merge_runs(self.first + lo, self.first + mid, self.first + mid, self.first + hi,
+				self.buffer + lo, self.comp);
+		} else {
+			_merge_runs(self.buffer + lo, self.buffer + mid, self.buffer + mid, self.buffer + hi,
+				self.first + lo, self.comp);
+		}
+	}
+
+	static void	copy_back( void * context, size_t i ) {
+		_sort_task &	self = *static_cast<_sort_task *>(context);
+
+		ft::copy(self.buffer + self.bound(i), self.buffer + self.bound(i + 1), self.first + self.bound(i));
+	}
+};
+
+template <typename RandomAccessIterator, typename Compare>
+void	sort( RandomAccessIterator first, RandomAccessIterator last, Compare comp, const policy & p = policy() ) {
+	typedef typename iterator_traits<RandomAccessIterator>::value_type	value_type;
+
+	_chunks<RandomAccessIterator>	chunks(first, last, p);
+
+	if (chunks.serial) {
+		ft::sort(first, last, comp);
+		return ;
+	}
+	size_t	runs = 1;
+
+	while (runs < chunks.pool->size() && runs < chunks.count) {
+		runs *= 2;
+	}
+
+	std::allocator<value_type>					alloc;
+	_sort_task<RandomAccessIterator, Compare>	task = { first, NULL, comp, chunks.n, runs, 1, true };
+
+	chunks.pool->run(&task.sort, &task, runs);
+	if (runs < 2) {
+		return ;
+	}
+	task.buffer = alloc.allocate(chunks.n);
+	try {
+		ft::uninitialized_copy(first, last, task.buffer, alloc);
+	} catch (...) {
+		alloc.deallocate(task.buffer, chunks.n);
+		throw;
+	}
+	try {
+		for (task.width = 2; task.width <= runs; task.width *= 2) {
+			chunks.pool->run(&task.merge, &task, runs / task.width);
+			task.to_buffer = !task.to_buffer;
+		}
+		if (!task.to_buffer) {
+			chunks.pool->run(&task.copy_back, &task, runs);
+		}
+	} catch (...) {
+		ft::destroy(task.buffer, task.buffer + chunks.n, alloc);
+		alloc.deallocate(task.buffer, chunks.n);
+		throw;
+	}
+	ft::destroy(task.buffer, task.buffer + chunks.n, alloc);
+	alloc.deallocate(task.buffer, chunks.n);
+}
+
+template <typename RandomAccessIterator>
+void	sort( RandomAccessIterator first, RandomAccessIterator last, const policy & p = policy() ) {
+	ft::parallel::sort(first, last, _iter_less(), p);
+}
+
+}
+
+}
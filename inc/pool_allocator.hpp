@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstddef> // ptrdiff_t
+#include <new> // bad_alloc, placement new, operator new
+
+#include "memory.hpp"
+
+namespace ft {
+
+// ************************************************************************** //
+//                           pool_allocator template                          //
+// ************************************************************************** //
+
+/*
+**	Carves single objects out of SlabSize byte slabs, for node based
+**	containers: ft::map and ft::set rebind it to their tree nodes. Nodes sit
+**	next to each other with no per block header, a freed node goes on a free
+**	list for the next allocation, and release() hands every slab back at
+**	once, which Tree::clear() uses through allocator_can_release.
+**
+**	Each instance owns its pool: copies start with an empty one, assignment
+**	keeps its own and swap_allocators exchanges them. Blocks of more than one
+**	object go straight to operator new.
+*/
+
+template <typename T, size_t SlabSize = 65536>
+class pool_allocator {
+
+public:
+	/* Member types */
+	typedef T				value_type;
+	typedef T *				pointer;
+	typedef const T *		const_pointer;
+	typedef T &				reference;
+	typedef const T &		const_reference;
+	typedef size_t			size_type;
+	typedef ptrdiff_t		difference_type;
+
+	template <typename U>
+	struct rebind { typedef pool_allocator<U, SlabSize> other; };
+
+	/* Constructors */
+	pool_allocator( void ) : _slabs(NULL), _free(NULL), _cursor(NULL), _end(NULL) { /* no-op */ }
+	pool_allocator( const pool_allocator & ) : _slabs(NULL), _free(NULL), _cursor(NULL), _end(NULL) { /* no-op */ }
+	template <typename U>
+	pool_allocator( const pool_allocator<U, SlabSize> & ) : _slabs(NULL), _free(NULL), _cursor(NULL), _end(NULL) { /* no-op */ }
+	~pool_allocator( void ) { release(); }
+
+	// The pool stays with this instance
+	pool_allocator &	operator = ( const pool_allocator & ) { return *this; }
+
+	pointer			address( reference x ) const { return &x; }
+	const_pointer	address( const_reference x ) const { return &x; }
+	size_type		max_size( void ) const { return static_cast<size_type>(-1) / sizeof(T); }
+
+	pointer	allocate( size_type n, const void * hint = 0 ) {
+		(void)hint;
+		if (n != 1) {
+			if (n > max_size()) {
+				throw std::bad_alloc();
+			}
+			return static_cast<pointer>(::operator new(n * sizeof(T)));
+		}
+		if (_free) {
+			_block *	block = _free;
+
+			_free = block->next;
+			return reinterpret_cast<pointer>(block);
+		}
+		if (_cursor == _end) {
+			_grow();
+		}
+		pointer	p = reinterpret_cast<pointer>(_cursor);
+
+		_cursor += _block_size;
+		return p;
+	}
+
+	void	deallocate( pointer p, size_type n ) {
+		if (n != 1) {
+			::operator delete(p);
+			return;
+		}
+		_block *	block = reinterpret_cast<_block *>(p);
+
+		block->next = _free;
+		_free = block;
+	}
+
+	void	construct( pointer p, const_reference val ) { new (static_cast<void *>(p)) T(val); }
+	void	destroy( pointer p ) { p->~T(); }
+
+	// Frees every slab: whatever is still allocated from the pool is gone
+	void	release( void ) {
+		while (_slabs) {
+			_slab *	next = _slabs->next;
+
+			::operator delete(_slabs);
+			_slabs = next;
+		}
+		_free = NULL;
+		_cursor = NULL;
+		_end = NULL;
+	}
+
+	void	swap( pool_allocator & other ) {
+		_swap(_slabs, other._slabs);
+		_swap(_free, other._free);
+		_swap(_cursor, other._cursor);
+		_swap(_end, other._end);
+	}
+
+private:
+	struct _block { _block * next; };
+
+	// Slab header, padded to the strictest fundamental alignment
+	union _slab {
+		_slab *		next;
+		long double	_align;
+	};
+
+	// Blocks hold a free list link when free and stay pointer aligned
+	enum {
+		_object_size = sizeof(T) > sizeof(_block) ? sizeof(T) : sizeof(_block),
+		_block_size = (_object_size + sizeof(_block) - 1) / sizeof(_block) * sizeof(_block),
+		_slab_blocks = SlabSize > sizeof(_slab) + _block_size ? (SlabSize - sizeof(_slab)) / _block_size : 1
+	};
+
+	void	_grow( void ) {
+		_slab *	slab = static_cast<_slab *>(::operator new(sizeof(_slab) + _slab_blocks * _block_size));
+
+		slab->next = _slabs;
+		_slabs = slab;
+		_cursor = reinterpret_cast<char *>(slab + 1);
+		_end = _cursor + _slab_blocks * _block_size;
+	}
+
+	template <typename U>
+	static void	_swap( U & a, U & b ) {
+		U	tmp = a;
+
+		a = b;
+		b = tmp;
+	}
+
+	_slab *		_slabs;
+	_block *	_free;
+	char *		_cursor;
+	char *		_end;
+
+};
+
+/* Non-member functions */
+
+// Only the instance that handed out a block can take it back
+template <typename T, typename U, size_t SlabSize>
+bool	operator == ( const pool_allocator<T, SlabSize> & lhs, const pool_allocator<U, SlabSize> & rhs ) {
+	return static_cast<const void *>(&lhs) == static_cast<const void *>(&rhs);
+}
+
+template <typename T, typename U, size_t SlabSize>
+bool	operator != ( const pool_allocator<T, SlabSize> & lhs, const pool_allocator<U, SlabSize> & rhs ) { return !(lhs == rhs); }
+
+template <typename T, size_t SlabSize>
+void	swap_allocators( pool_allocator<T, SlabSize> & a, pool_allocator<T, SlabSize> & b ) { a.swap(b); }
+
+template <typename T, size_t SlabSize>
+struct allocator_can_release< pool_allocator<T, SlabSize> > : true_type {};
+
+}
@@ -0,0 +1,325 @@
+#pragma once
+
+#include <algorithm> // swap
+#include <cstddef> // size_t
+#include <functional> // less
+#include <memory> // allocator
+
+#include "iterator.hpp"
+#include "algorithm.hpp"
+#include "vector.hpp"
+#include "aligned_allocator.hpp"
+
+namespace ft {
+
+// ************************************************************************** //
+//                                  prefetch                                  //
+// ************************************************************************** //
+
+/*
+**	Hints the cache about an element the search may read next. Only pointers
+**	can be prefetched: other iterators are left alone.
+*/
+
+template <typename Iterator>
+void	_prefetch( Iterator ) { /* no-op */ }
+
+template <typename T>
+void	_prefetch( T * p ) {
+#if defined(__GNUC__)
+	__builtin_prefetch(p);
+#else
+	(void)p;
+#endif
+}
+
+
+// ************************************************************************** //
+//                         lower_bound / upper_bound                          //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/algorithm/lower_bound
+**	https://en.cppreference.com/w/cpp/algorithm/upper_bound
+**
+**	On random access ranges the loop has no data-dependent branch: every step
+**	halves the range and picks its base with a conditional move, so the
+**	branch predictor has nothing to miss. Both candidate midpoints of the next
+**	step are prefetched while the current comparison waits on memory.
+*/
+
+template <typename ForwardIterator, typename T, typename Compare>
+ForwardIterator	_lower_bound( ForwardIterator first, ForwardIterator last, const T & val, Compare comp,
+	forward_iterator_tag ) {
+	typename iterator_traits<ForwardIterator>::difference_type	n = ft::distance(first, last);
+
+	while (n > 0) {
+		typename iterator_traits<ForwardIterator>::difference_type	half = n / 2;
+		ForwardIterator												mid = first;
+
+		ft::advance(mid, half);
+		if (comp(*mid, val)) {
+			first = ++mid;
+			n -= half + 1;
+		} else {
+			n = half;
+		}
+	}
+	return first;
+}
+
+template <typename RandomAccessIterator, typename T, typename Compare>
+RandomAccessIterator	_lower_bound( RandomAccessIterator first, RandomAccessIterator last, const T & val,
+	Compare comp, random_access_iterator_tag ) {
+	typename iterator_traits<RandomAccessIterator>::difference_type	n = last - first;
+
+	if (n == 0) {
+		return first;
+	}
+	while (n > 1) {
+		typename iterator_traits<RandomAccessIterator>::difference_type	half = n / 2;
+
+		_prefetch(first + half / 2);
+		_prefetch(first + half + half / 2);
+		first = comp(first[half], val) ? first + half : first;
+		n -= half;
+	}
+	return first + comp(*first, val);
+}
+
+template <typename ForwardIterator, typename T, typename Compare>
+ForwardIterator	_upper_bound( ForwardIterator first, ForwardIterator last, const T & val, Compare comp,
+	forward_iterator_tag ) {
+	typename iterator_traits<ForwardIterator>::difference_type	n = ft::distance(first, last);
+
+	while (n > 0) {
+		typename iterator_traits<ForwardIterator>::difference_type	half = n / 2;
+		ForwardIterator												mid = first;
+
+		ft::advance(mid, half);
+		if (!comp(val, *mid)) {
+			first = ++mid;
+			n -= half + 1;
+		} else {
+			n = half;
+		}
+	}
+	return first;
+}
+
+template <typename RandomAccessIterator, typename T, typename Compare>
+RandomAccessIterator	_upper_bound( RandomAccessIterator first, RandomAccessIterator last, const T & val,
+	Compare comp, random_access_iterator_tag ) {
+	typename iterator_traits<RandomAccessIterator>::difference_type	n = last - first;
+
+	if (n == 0) {
+		return first;
+	}
+	while (n > 1) {
+		typename iterator_traits<RandomAccessIterator>::difference_type	half = n / 2;
+
+		_prefetch(first + half / 2);
+		_prefetch(first + half + half / 2);
+		first = comp(val, first[half]) ? first : first + half;
+		n -= half;
+	}
+	return first + !comp(val, *first);
+}
+
+template <typename ForwardIterator, typename T, typename Compare>
+ForwardIterator	lower_bound( ForwardIterator first, ForwardIterator last, const T & val, Compare comp ) {
+	return _rewrap(first, _lower_bound(_unwrap(first), _unwrap(last), val, comp, _iterator_category(first)));
+}
+
+template <typename ForwardIterator, typename T>
+ForwardIterator	lower_bound( ForwardIterator first, ForwardIterator last, const T & val ) {
+	return ft::lower_bound(first, last, val, _iter_less());
+}
+
+template <typename ForwardIterator, typename T, typename Compare>
+ForwardIterator	upper_bound( ForwardIterator first, ForwardIterator last, const T & val, Compare comp ) {
+	return _rewrap(first, _upper_bound(_unwrap(first), _unwrap(last), val, comp, _iterator_category(first)));
+}
+
+template <typename ForwardIterator, typename T>
+ForwardIterator	upper_bound( ForwardIterator first, ForwardIterator last, const T & val ) {
+	return ft::upper_bound(first, last, val, _iter_less());
+}
+
+
+// ************************************************************************** //
+//                               binary_search                                //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/algorithm/binary_search
+*/
+
+template <typename ForwardIterator, typename T, typename Compare>
+bool	binary_search( ForwardIterator first, ForwardIterator last, const T & val, Compare comp ) {
+	first = ft::lower_bound(first, last, val, comp);
+	return first != last && !comp(val, *first);
+}
+
+template <typename ForwardIterator, typename T>
+bool	binary_search( ForwardIterator first, ForwardIterator last, const T & val ) {
+	return ft::binary_search(first, last, val, _iter_less());
+}
+
+
+// ************************************************************************** //
+//                          eytzinger_index template                          //
+// ************************************************************************** //
+
+/*
+**	A read-only copy of a sorted range in Eytzinger (breadth-first) order: the
+**	root at 1, the children of k at 2k and 2k + 1. The first levels of every
+**	search share the same few cache lines, and the 16 or so descendants four
+**	levels down sit next to each other, so they are prefetched in one line
+**	while the search walks there.
+**
+**	Lookups return a pointer into the index, NULL when there is no such
+**	element. The storage is aligned on cache lines.
+*/
+
+template <typename T, typename Compare = std::less<T> >
+class eytzinger_index {
+
+public:
+	/* Member types */
+	typedef T								value_type;
+	typedef Compare							value_compare;
+	typedef size_t							size_type;
+	typedef const T &						const_reference;
+	typedef const T *						const_pointer;
+
+private:
+	typedef ft::vector< T, aligned_allocator<T> >	storage_type;
+
+	// Elements in a cache line: the width of a node's descendants four levels down
+	enum { _block = sizeof(T) < 64 ? 64 / sizeof(T) : 1 };
+
+public:
+	/* Constructors */
+	explicit eytzinger_index( const value_compare & comp = value_compare() )
+		: _comp(comp), _tree(1) { /* no-op */ }
+
+	// [first, last) must be sorted by comp
+	template <typename ForwardIterator>
+	eytzinger_index( ForwardIterator first, ForwardIterator last, const value_compare & comp = value_compare() )
+		: _comp(comp), _tree(ft::distance(first, last) + 1) {
+		_build(first, 1);
+	}
+
+	template <typename Allocator, typename GrowthPolicy>
+	explicit eytzinger_index( const vector<T, Allocator, GrowthPolicy> & sorted, const value_compare & comp = value_compare() )
+		: _comp(comp), _tree(sorted.size() + 1) {
+		typename vector<T, Allocator, GrowthPolicy>::const_iterator	first = sorted.begin();
+
+		_build(first, 1);
+	}
+
+	eytzinger_index( const eytzinger_index & src ) : _comp(src._comp), _tree(src._tree) { /* no-op */ }
+
+	~eytzinger_index( void ) { /* no-op */ }
+
+	eytzinger_index &	operator = ( const eytzinger_index & rhs ) {
+		_comp = rhs._comp;
+		_tree = rhs._tree;
+		return *this;
+	}
+
+	/* Capacity */
+	bool		empty( void ) const { return size() == 0; }
+	size_type	size( void ) const { return _tree.size() - 1; }
+
+	/* Lookup */
+
+	// First element not less than val
+	const_pointer	lower_bound( const_reference val ) const {
+		const T *	tree = _tree.aligned_data();
+		size_type	n = size();
+		size_type	k = 1;
+
+		while (k <= n) {
+			_prefetch(tree + k * _block);
+			k = 2 * k + _comp(tree[k], val);
+		}
+		return _found(tree, k);
+	}
+
+	// First element greater than val
+	const_pointer	upper_bound( const_reference val ) const {
+		const T *	tree = _tree.aligned_data();
+		size_type	n = size();
+		size_type	k = 1;
+
+		while (k <= n) {
+			_prefetch(tree + k * _block);
+			k = 2 * k + !_comp(val, tree[k]);
+		}
+		return _found(tree, k);
+	}
+
+	const_pointer	find( const_reference val ) const {
+		const_pointer	p = lower_bound(val);
+
+		return p && !_comp(val, *p) ? p : NULL;
+	}
+
+	bool	contains( const_reference val ) const { return find(val) != NULL; }
+
+	/* Observers */
+	value_compare	value_comp( void ) const { return _comp; }
+
+	void	swap( eytzinger_index & other ) {
+		std::swap(_comp, other._comp);
+		_tree.swap(other._tree);
+	}
+
+private:
+	value_compare	_comp;
+	storage_type	_tree; // slot 0 is unused
+
+	// Lays out the subtree rooted at k, reading its elements in order from first
+	template <typename ForwardIterator>
+	void	_build( ForwardIterator & first, size_type k ) {
+		if (k < _tree.size()) {
+			_build(first, 2 * k);
+			_tree[k] = *first;
+			++first;
+			_build(first, 2 * k + 1);
+		}
+	}
+
+	/*
+	**	The search went right past every node it kept, then left once past the
+	**	answer: dropping the trailing ones and that zero climbs back to it. 0
+	**	means it never went left.
+	*/
+	static const_pointer	_found( const T * tree, size_type k ) {
+		k >>= _trailing_ones(k) + 1;
+		return k ? tree + k : NULL;
+	}
+
+	static size_type	_trailing_ones( size_type k ) {
+#if defined(__GNUC__)
+		return __builtin_ctzl(~k);
+#else
+		size_type	n = 0;
+
+		for (; k & 1; k >>= 1) {
+			n++;
+		}
+		return n;
+#endif
+	}
+
+};
+
+/* Non-member functions */
+
+template <typename T, typename Compare>
+void	swap( eytzinger_index<T, Compare> & lhs, eytzinger_index<T, Compare> & rhs ) { lhs.swap(rhs); }
+
+}
@@ -97,21 +97,14 @@ public:
 	/* Modifiers */
 	void	clear( void ) { tree.clear(); }
 
-	pair<iterator, bool>	insert( const_reference val ) {
-		if (has_key(val)) {
-			return ft::make_pair(--upper_bound(val), false);
-		}
-		return tree.insert(val);
-	} // single element
+	pair<iterator, bool>	insert( const_reference val ) { return tree.insert_unique(val); } // single element
 
 	template <typename InputIterator>
 	void		insert( InputIterator first, InputIterator last ) { while (first != last) insert(*first++); } // range
 
 	iterator	insert( iterator position, const_reference val ) {
-		if (has_key(val)) {
-			return --upper_bound(val);
-		}
-		return tree.insert(position, val);
+		(void)position;
+		return tree.insert_unique(val).first;
 	} // with hint
 
 	void		erase( iterator position ) { tree.erase(position); }
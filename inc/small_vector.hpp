@@ -0,0 +1,465 @@
+#pragma once
+
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+
+#include "iterators/RandomAccessIterator.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "algorithm.hpp"
+#include "memory.hpp"
+#include "growth.hpp"
+
+namespace ft {
+
+// ************************************************************************** //
+//                            small_vector template                           //
+// ************************************************************************** //
+
+/*
+**	A vector that stores its first N elements inside the object itself and only
+**	goes to the allocator once it outgrows them. Short vectors cost no heap
+**	allocation at all. The interface is ft::vector's, except that the
+**	capacity never drops below N: shrinking and release() go back inline.
+**
+**	Iterators, pointers and references are invalidated by any operation that
+**	changes the capacity, including swap while the elements are stored inline.
+**
+**	The inline buffer is aligned for the fundamental types only.
+*/
+
+template<
+	typename T,
+	size_t N,
+	typename Allocator = std::allocator<T>,
+	typename GrowthPolicy = ft::factor_growth<2, 1>
+>
+class small_vector {
+
+public:
+	/* Member types */
+	typedef T													value_type;
+	typedef Allocator											allocator_type;
+	typedef GrowthPolicy										growth_policy;
+	typedef typename allocator_type::reference					reference;
+	typedef typename allocator_type::const_reference			const_reference;
+	typedef typename allocator_type::pointer					pointer;
+	typedef typename allocator_type::const_pointer				const_pointer;
+	typedef RandomAccessIterator<value_type>					iterator;
+	typedef RandomAccessIterator<const value_type>				const_iterator;
+	typedef ft::reverse_iterator<iterator>						reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>				const_reverse_iterator;
+	typedef typename iterator_traits<iterator>::difference_type	difference_type;
+	typedef size_t												size_type;
+
+	static const size_type	inline_capacity = N;
+
+protected:
+	pointer	c;
+
+private:
+	/* Member variables */
+	size_type		_size;
+	size_type		_capacity;
+	allocator_type	_allocator;
+	union {
+		unsigned char	bytes[(N ? N : 1) * sizeof(T)];
+		long double		align_float;
+		long long		align_integer;
+		void *			align_pointer;
+	}				_buffer;
+
+public:
+	/* Constructors */
+	explicit small_vector( const allocator_type & alloc = allocator_type() )
+		: c(_inline()), _size(0), _capacity(N), _allocator(alloc) { /* no-op */ } // default
+
+	explicit small_vector( size_type n,
+						   const value_type & val = value_type(),
+						   const allocator_type & alloc = allocator_type() )
+		: c(_inline()), _size(0), _capacity(N), _allocator(alloc) {
+		try {
+			insert(end(), n, val);
+		} catch (...) {
+			_release_storage();
+			throw;
+		}
+	} // fill
+
+	template <typename InputIterator>
+	small_vector( typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first,
+				  InputIterator last,
+				  const allocator_type & alloc = allocator_type() )
+		: c(_inline()), _size(0), _capacity(N), _allocator(alloc) {
+		try {
+			insert(end(), first, last);
+		} catch (...) {
+			_release_storage();
+			throw;
+		}
+	} // range
+
+	small_vector( const small_vector & v )
+		: c(_inline()), _size(0), _capacity(N), _allocator(v._allocator) {
+		try {
+			insert(end(), v.begin(), v.end());
+		} catch (...) {
+			_release_storage();
+			throw;
+		}
+	} // copy
+
+	/* Assignment operator */
+	small_vector &	operator = ( const small_vector & v ) {
+		if (this != &v) {
+			assign(v.begin(), v.end());
+		}
+		return *this;
+	}
+
+	/* Destructor */
+	~small_vector( void ) { _release_storage(); }
+
+	/* Iterators */
+	iterator			begin( void ) { return iterator(c); }
+	const_iterator		begin( void ) const { return const_iterator(c); }
+	iterator			end( void ) { return iterator(c + _size); }
+	const_iterator		end( void ) const { return const_iterator(c + _size); }
+	reverse_iterator		rbegin( void ) { return reverse_iterator(end()); }
+	const_reverse_iterator	rbegin( void ) const { return const_reverse_iterator(end()); }
+	reverse_iterator		rend( void ) { return reverse_iterator(begin()); }
+	const_reverse_iterator	rend( void ) const { return const_reverse_iterator(begin()); }
+
+	/* Capacity */
+	size_type	size( void ) const { return _size; }
+	size_type	max_size( void ) const { return _allocator.max_size(); }
+	size_type	capacity( void ) const { return _capacity; }
+	bool		empty( void ) const { return !_size; }
+	bool		is_inline( void ) const { return c == _inline(); }
+
+	void	resize( size_type n, value_type val = value_type() ) {
+		if (n > _size) {
+			if (n > _capacity) {
+				_reallocate(_grow(n - _size));
+			}
+			ft::uninitialized_fill_n(c + _size, n - _size, val, _allocator);
+			_size = n;
+		} else {
+			erase(begin() + n, end());
+		}
+	}
+
+	// Like resize, but new scalar elements are left uninitialized (to be overwritten right away)
+	void	resize_default_init( size_type n ) {
+		if (n > _size) {
+			if (n > _capacity) {
+				_reallocate(_grow(n - _size));
+			}
+			ft::uninitialized_default_n(c + _size, n - _size, _allocator);
+			_size = n;
+		} else {
+			erase(begin() + n, end());
+		}
+	}
+
+	void	reserve( size_type n ) {
+		if (n > max_size()) {
+			throw std::length_error("small_vector::reserve");
+		}
+		if (n > _capacity) {
+			_reallocate(n);
+		}
+	}
+
+	// Sets the capacity to exactly max(n, size()), or back to the inline buffer when that fits
+	void	reserve_exact( size_type n ) {
+		if (n > max_size()) {
+			throw std::length_error("small_vector::reserve_exact");
+		}
+		n = std::max(n, _size);
+		if (n != _capacity) {
+			_reallocate(n);
+		}
+	}
+
+	// Moves the elements back inline when they fit
+	void	shrink_to_fit( void ) { reserve_exact(_size); }
+
+	// Destroys every element and goes back to the inline buffer
+	void	release( void ) { clear(); _reallocate(0); }
+
+	/* Element access */
+	reference			operator [] ( size_type n ) { return c[n]; }
+	const_reference		operator [] ( size_type n ) const { return c[n]; }
+	reference			at( size_type n ) { if (n >= _size) throw std::out_of_range("small_vector::at"); return c[n]; }
+	const_reference		at( size_type n ) const { if (n >= _size) throw std::out_of_range("small_vector::at"); return c[n]; }
+	reference			front( void ) { return c[0]; }
+	const_reference		front( void ) const { return c[0]; }
+	reference			back( void ) { return c[_size - 1]; }
+	const_reference		back( void ) const { return c[_size - 1]; }
+	value_type *		data( void ) { return c; }
+	const value_type *	data( void ) const { return c; }
+
+	/* Modifiers */
+	template <typename InputIterator>
+	void	assign( typename ft::enable_if<!ft::is_integral<InputIterator>::value,
+					InputIterator>::type first,
+					InputIterator last ) {
+		clear();
+		insert(end(), first, last);
+	} // range
+
+	void	assign( size_type n, const value_type & val ) {
+		const value_type	copy(val); // val may be one of the elements
+
+		clear();
+		insert(end(), n, copy);
+	} // fill
+
+	void	push_back( const value_type & val ) {
+		if (_capacity == _size) {
+			const value_type	copy(val); // val may be one of our elements
+			size_type			capacity = _grow(1);
+
+			_move_to(_allocate(capacity), capacity, _size, 0);
+			_allocator.construct(c + _size, copy);
+		} else {
+			_allocator.construct(c + _size, val);
+		}
+		_size++;
+	}
+
+	void	pop_back( void ) { if (_size > 0) erase(end() - 1); }
+
+	// single element
+	iterator	insert( iterator position, const value_type & val ) {
+		size_type	j = position - begin();
+
+		insert(position, size_type(1), val);
+		return iterator(c + j);
+	}
+
+	// fill
+	void	insert( iterator position, size_type n, const value_type & val ) {
+		if (n == 0) {
+			return;
+		}
+		size_type			j = position - begin();
+		const value_type	copy(val); // val may live in the storage we are about to move
+		size_type			live = std::min(_open_gap(j, n), j + n);
+
+		try {
+			ft::fill(c + j, c + live, copy);
+			ft::uninitialized_fill_n(c + live, j + n - live, copy, _allocator);
+		} catch (...) {
+			_abandon_gap(j, n, live);
+			throw;
+		}
+		_size += n;
+	}
+
+	// range
+	template <typename InputIterator>
+	void	insert( iterator position,
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first,
+					InputIterator last ) {
+		_range_insert(position - begin(), first, last, ft::_iterator_category(first));
+	}
+
+	iterator	erase( iterator position ) { return erase(position, position + 1); } // single element
+
+	iterator	erase( iterator first, iterator last ) {
+		size_type	n = last - first;
+
+		if (n) {
+			ft::close_gap(first.base(), c + _size, n, _allocator);
+			_size -= n;
+		}
+		return first;
+	} // range
+
+	// Never copies a heap block, only the inline elements move
+	void	swap( small_vector & v ) {
+		if (this == &v) {
+			return ;
+		}
+		if (is_inline() && v.is_inline()) {
+			_swap_inline(v);
+		} else if (is_inline()) {
+			_swap_with_heap(v);
+		} else if (v.is_inline()) {
+			v._swap_with_heap(*this);
+		} else {
+			std::swap(c, v.c);
+			std::swap(_capacity, v._capacity);
+		}
+		std::swap(_size, v._size);
+		std::swap(_allocator, v._allocator);
+	}
+
+	void	clear( void ) { erase(begin(), end()); }
+
+	/* Allocator */
+	allocator_type	get_allocator( void ) const { return _allocator; }
+
+private:
+
+	pointer			_inline( void ) { return reinterpret_cast<pointer>(_buffer.bytes); }
+	const_pointer	_inline( void ) const { return reinterpret_cast<const_pointer>(_buffer.bytes); }
+
+	// capacity needed to hold n more elements
+	size_type	_grow( size_type n ) const {
+		return growth_policy::grow(_size, _size + n, max_size(), sizeof(value_type));
+	}
+
+	// Moves the elements to the inline buffer when n fits in it, to a new heap block otherwise
+	void	_reallocate( size_type n ) {
+		if (n <= N) {
+			if (!is_inline()) {
+				_move_to(_inline(), N, _size, 0);
+			}
+			return ;
+		}
+		_move_to(_allocate(n), n, _size, 0);
+	}
+
+	/*
+	**	Relocates the elements to tmp (the inline buffer or a new heap block of
+	**	capacity elements), leaving n free slots at index j, and makes it the
+	**	storage. If an element throws on the way, a new heap block is freed and
+	**	the elements stay where they were.
+	*/
+	void	_move_to( pointer tmp, size_type capacity, size_type j, size_type n ) {
+		try {
+			ft::uninitialized_relocate_gap(c, c + _size, tmp, j, n, _allocator);
+		} catch (...) {
+			if (tmp != _inline()) {
+				_allocator.deallocate(tmp, capacity);
+			}
+			throw;
+		}
+		_deallocate();
+		c = tmp;
+		_capacity = capacity;
+	}
+
+	// Both inline: swaps the common prefix, relocates the rest of the longer one
+	void	_swap_inline( small_vector & v ) {
+		small_vector &	shorter = _size < v._size ? *this : v;
+		small_vector &	longer = _size < v._size ? v : *this;
+
+		std::swap_ranges(shorter.c, shorter.c + shorter._size, longer.c);
+		ft::uninitialized_relocate(longer.c + shorter._size, longer.c + longer._size,
+								   shorter.c + shorter._size, _allocator);
+	}
+
+	// We are inline and v is not: we take v's block, v takes our elements inline
+	void	_swap_with_heap( small_vector & v ) {
+		pointer	block = v.c;
+
+		ft::uninitialized_relocate(c, c + _size, v._inline(), _allocator);
+		v.c = v._inline();
+		c = block;
+		std::swap(_capacity, v._capacity);
+	}
+
+	template <typename InputIterator>
+	void	_range_insert( size_type j, InputIterator first, InputIterator last, ft::input_iterator_tag ) {
+		small_vector	tmp(_allocator); // can only be read once
+
+		for (; first != last; ++first) {
+			tmp.push_back(*first);
+		}
+		_range_insert(j, tmp.begin(), tmp.end(), ft::random_access_iterator_tag());
+	} // single pass
+
+	template <typename ForwardIterator>
+	void	_range_insert( size_type j, ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag ) {
+		size_type	n = ft::distance(first, last);
+
+		if (n == 0) {
+			return;
+		}
+
+		size_type		live = std::min(_open_gap(j, n), j + n);
+		ForwardIterator	mid = first;
+
+		ft::advance(mid, live - j);
+		try {
+			ft::copy(first, mid, c + j);
+			ft::uninitialized_copy(mid, last, c + live, _allocator);
+		} catch (...) {
+			_abandon_gap(j, n, live);
+			throw;
+		}
+		_size += n;
+	} // sized
+
+	/*
+	**	Makes room for n elements at index j, growing the storage if needed.
+	**	Returns the index where uninitialized memory starts (see ft::open_gap).
+	*/
+	size_type	_open_gap( size_type j, size_type n ) {
+		if (_capacity < _size + n) {
+			size_type	capacity = _grow(n);
+
+			_move_to(_allocate(capacity), capacity, j, n);
+			return j;
+		}
+		return ft::open_gap(c + j, c + _size, n, _allocator) - c;
+	}
+
+	// Filling the gap threw: [live, j + n) holds nothing, the elements past it are dropped
+	void	_abandon_gap( size_type j, size_type n, size_type live ) {
+		ft::destroy(c + j + n, c + _size + n, _allocator);
+		_size = live;
+	}
+
+	/* Allocator wrappers */
+	pointer	_allocate( size_type capacity ) { return _allocator.allocate(capacity); }
+	void	_deallocate( void ) { if (!is_inline()) _allocator.deallocate(c, _capacity); }
+
+	// The destructor, also run by constructors that throw
+	void	_release_storage( void ) { clear(); _deallocate(); }
+
+};
+
+/* Non-member functions */
+
+// relational operators
+template <typename T, size_t N, typename Alloc, typename Growth>
+bool	operator == ( const small_vector<T, N, Alloc, Growth> & lhs, const small_vector<T, N, Alloc, Growth> & rhs ) {
+	return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename T, size_t N, typename Alloc, typename Growth>
+bool	operator != ( const small_vector<T, N, Alloc, Growth> & lhs, const small_vector<T, N, Alloc, Growth> & rhs ) {
+	return !(lhs == rhs);
+}
+
+template <typename T, size_t N, typename Alloc, typename Growth>
+bool	operator < ( const small_vector<T, N, Alloc, Growth> & lhs, const small_vector<T, N, Alloc, Growth> & rhs ) {
+	return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename T, size_t N, typename Alloc, typename Growth>
+bool	operator <= ( const small_vector<T, N, Alloc, Growth> & lhs, const small_vector<T, N, Alloc, Growth> & rhs ) {
+	return !(rhs < lhs);
+}
+
+template <typename T, size_t N, typename Alloc, typename Growth>
+bool	operator > ( const small_vector<T, N, Alloc, Growth> & lhs, const small_vector<T, N, Alloc, Growth> & rhs ) {
+	return rhs < lhs;
+}
+
+template <typename T, size_t N, typename Alloc, typename Growth>
+bool	operator >= ( const small_vector<T, N, Alloc, Growth> & lhs, const small_vector<T, N, Alloc, Growth> & rhs ) {
+	return !(lhs < rhs);
+}
+
+// swap
+template <typename T, size_t N, typename Alloc, typename Growth>
+void	swap( small_vector<T, N, Alloc, Growth> & lhs, small_vector<T, N, Alloc, Growth> & rhs ) { lhs.swap(rhs); }
+
+}
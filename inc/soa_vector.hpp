@@ -0,0 +1,334 @@
+#pragma once
+
+#include <algorithm> // min
+#include <memory>
+#include <stdexcept>
+
+#include "iterators/SoaIterator.hpp"
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+#include "algorithm.hpp"
+#include "growth.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+// ************************************************************************** //
+//                             soa_vector template                            //
+// ************************************************************************** //
+
+/*
+**	A vector of pairs stored as a structure of arrays: one ft::vector for the
+**	first members, one for the second. A scan over the keys only reads the
+**	keys, and keys() / values() give both columns as plain arrays ready for
+**	vectorized loops. Use an aligned_allocator to align them.
+**
+**	Elements are accessed through proxies (SoaReference) holding a reference
+**	into each column. They convert to value_type and write through when
+**	assigned, but unlike a value_type & they can't outlive an invalidation:
+**	iterators and proxies are invalidated as for ft::vector.
+**
+**	Only soa_vector< ft::pair<A, B> > is defined.
+*/
+
+template<
+	typename T,
+	typename Allocator = std::allocator<T>,
+	typename GrowthPolicy = ft::factor_growth<2, 1>
+>
+class soa_vector;
+
+template <typename A, typename B, typename Allocator, typename GrowthPolicy>
+class soa_vector< pair<A, B>, Allocator, GrowthPolicy > {
+
+public:
+	/* Member types */
+	typedef pair<A, B>												value_type;
+	typedef A														first_type;
+	typedef B														second_type;
+	typedef Allocator												allocator_type;
+	typedef GrowthPolicy											growth_policy;
+	typedef typename allocator_type::template rebind<A>::other		first_allocator_type;
+	typedef typename allocator_type::template rebind<B>::other		second_allocator_type;
+	typedef SoaReference<A, B>										reference;
+	typedef SoaReference<const A, const B>							const_reference;
+	typedef SoaIterator<A, B>										iterator;
+	typedef SoaIterator<const A, const B>							const_iterator;
+	typedef typename iterator::pointer								pointer;
+	typedef typename const_iterator::pointer						const_pointer;
+	typedef ft::reverse_iterator<iterator>							reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>					const_reverse_iterator;
+	typedef typename iterator_traits<iterator>::difference_type		difference_type;
+	typedef size_t													size_type;
+
+private:
+	typedef ft::vector<A, first_allocator_type, GrowthPolicy>		first_column;
+	typedef ft::vector<B, second_allocator_type, GrowthPolicy>		second_column;
+
+	/* Member variables */
+	first_column	_keys;
+	second_column	_values;
+
+public:
+	/* Constructors */
+	explicit soa_vector( const allocator_type & alloc = allocator_type() )
+		: _keys(first_allocator_type(alloc)), _values(second_allocator_type(alloc)) { /* no-op */ } // default
+
+	explicit soa_vector( size_type n,
+						 const value_type & val = value_type(),
+						 const allocator_type & alloc = allocator_type() )
+		: _keys(n, val.first, first_allocator_type(alloc)), _values(n, val.second, second_allocator_type(alloc)) {
+		/* no-op */
+	} // fill
+
+	template <typename InputIterator>
+	soa_vector( typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first,
+				InputIterator last,
+				const allocator_type & alloc = allocator_type() )
+		: _keys(first_allocator_type(alloc)), _values(second_allocator_type(alloc)) {
+		insert(end(), first, last);
+	} // range
+
+	soa_vector( const soa_vector & src ) : _keys(src._keys), _values(src._values) { /* no-op */ } // copy
+
+	/* Assignment operator */
+	soa_vector &	operator = ( const soa_vector & rhs ) {
+		if (this != &rhs) {
+			soa_vector	tmp(rhs);
+
+			swap(tmp);
+		}
+		return *this;
+	}
+
+	/* Destructor */
+	~soa_vector( void ) { /* no-op */ }
+
+	/* Iterators */
+	iterator				begin( void ) { return iterator(_keys.data(), _values.data()); }
+	const_iterator			begin( void ) const { return const_iterator(_keys.data(), _values.data()); }
+	iterator				end( void ) { return begin() + size(); }
+	const_iterator			end( void ) const { return begin() + size(); }
+	reverse_iterator		rbegin( void ) { return reverse_iterator(end()); }
+	const_reverse_iterator	rbegin( void ) const { return const_reverse_iterator(end()); }
+	reverse_iterator		rend( void ) { return reverse_iterator(begin()); }
+	const_reverse_iterator	rend( void ) const { return const_reverse_iterator(begin()); }
+
+	/* Capacity */
+	size_type	size( void ) const { return _keys.size(); }
+	size_type	max_size( void ) const { return std::min(_keys.max_size(), _values.max_size()); }
+	size_type	capacity( void ) const { return std::min(_keys.capacity(), _values.capacity()); }
+	bool		empty( void ) const { return _keys.empty(); }
+
+	void	resize( size_type n, value_type val = value_type() ) {
+		_values.reserve(n);
+		_keys.resize(n, val.first);
+		try {
+			_values.resize(n, val.second);
+		} catch (...) {
+			_trim_columns();
+			throw;
+		}
+	}
+
+	void	reserve( size_type n ) {
+		_keys.reserve(n);
+		_values.reserve(n);
+	}
+
+	void	shrink_to_fit( void ) {
+		_keys.shrink_to_fit();
+		_values.shrink_to_fit();
+	}
+
+	/* Element access */
+	reference		operator [] ( size_type n ) { return reference(_keys[n], _values[n]); }
+	const_reference	operator [] ( size_type n ) const { return const_reference(_keys[n], _values[n]); }
+	reference		at( size_type n ) { _check_range(n); return (*this)[n]; }
+	const_reference	at( size_type n ) const { _check_range(n); return (*this)[n]; }
+	reference		front( void ) { return (*this)[0]; }
+	const_reference	front( void ) const { return (*this)[0]; }
+	reference		back( void ) { return (*this)[size() - 1]; }
+	const_reference	back( void ) const { return (*this)[size() - 1]; }
+
+	// The columns, size() elements each
+	first_type *			keys( void ) { return _keys.data(); }
+	const first_type *		keys( void ) const { return _keys.data(); }
+	second_type *			values( void ) { return _values.data(); }
+	const second_type *		values( void ) const { return _values.data(); }
+
+	/* Modifiers */
+	template <typename InputIterator>
+	void	assign( typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first,
+					InputIterator last ) {
+		soa_vector	tmp(first, last, get_allocator());
+
+		swap(tmp);
+	} // range
+
+	void	assign( size_type n, const value_type & val ) {
+		_values.reserve(n);
+		_keys.assign(n, val.first);
+		try {
+			_values.assign(n, val.second);
+		} catch (...) {
+			_trim_columns();
+			throw;
+		}
+	} // fill
+
+	void	push_back( const value_type & val ) { push_back(val.first, val.second); }
+
+	void	push_back( const first_type & key, const second_type & value ) {
+		_keys.push_back(key);
+		try {
+			_values.push_back(value);
+		} catch (...) {
+			_keys.pop_back();
+			throw;
+		}
+	}
+
+	void	pop_back( void ) {
+		_keys.pop_back();
+		_values.pop_back();
+	}
+
+	// single element
+	iterator	insert( iterator position, const value_type & val ) {
+		size_type	j = position - begin();
+
+		insert(position, size_type(1), val);
+		return begin() + j;
+	}
+
+	// fill
+	void	insert( iterator position, size_type n, const value_type & val ) {
+		size_type	j = position - begin();
+
+		_keys.insert(_keys.begin() + j, n, val.first);
+		try {
+			_values.insert(_values.begin() + j, n, val.second);
+		} catch (...) {
+			_keys.erase(_keys.begin() + j, _keys.begin() + j + n);
+			throw;
+		}
+	}
+
+	// range
+	template <typename InputIterator>
+	void	insert( iterator position,
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first,
+					InputIterator last ) {
+		_range_insert(position - begin(), first, last, ft::_iterator_category(first));
+	}
+
+	iterator	erase( iterator position ) { return erase(position, position + 1); } // single element
+
+	iterator	erase( iterator first, iterator last ) {
+		size_type	j = first - begin();
+		size_type	k = last - begin();
+
+		_keys.erase(_keys.begin() + j, _keys.begin() + k);
+		_values.erase(_values.begin() + j, _values.begin() + k);
+		return begin() + j;
+	} // range
+
+	void	swap( soa_vector & other ) {
+		_keys.swap(other._keys);
+		_values.swap(other._values);
+	}
+
+	void	clear( void ) {
+		_keys.clear();
+		_values.clear();
+	}
+
+	/* Allocator */
+	allocator_type	get_allocator( void ) const { return allocator_type(_keys.get_allocator()); }
+
+private:
+	template <typename InputIterator>
+	void	_range_insert( size_type j, InputIterator first, InputIterator last, ft::input_iterator_tag ) {
+		soa_vector	tmp(get_allocator()); // can only be read once
+
+		for (; first != last; ++first) {
+			tmp.push_back(*first);
+		}
+		_insert_columns(j, tmp._keys.begin(), tmp._keys.end(), tmp._values.begin(), tmp._values.end());
+	} // single pass
+
+	template <typename ForwardIterator>
+	void	_range_insert( size_type j, ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag ) {
+		typedef SoaColumnIterator<ForwardIterator, false>	key_iterator;
+		typedef SoaColumnIterator<ForwardIterator, true>	value_iterator;
+
+		_insert_columns(j, key_iterator(first), key_iterator(last), value_iterator(first), value_iterator(last));
+	} // column by column
+
+	// Inserts the keys then the values, taking the keys back out if the values throw
+	template <typename KeyIterator, typename ValueIterator>
+	void	_insert_columns( size_type j, KeyIterator kfirst, KeyIterator klast, ValueIterator vfirst, ValueIterator vlast ) {
+		size_type	n = size();
+
+		_keys.insert(_keys.begin() + j, kfirst, klast);
+		n = size() - n;
+		try {
+			_values.insert(_values.begin() + j, vfirst, vlast);
+		} catch (...) {
+			_keys.erase(_keys.begin() + j, _keys.begin() + j + n);
+			throw;
+		}
+	}
+
+	// After a column threw: drops the rows only the other column holds
+	void	_trim_columns( void ) {
+		size_type	n = std::min(_keys.size(), _values.size());
+
+		_keys.erase(_keys.begin() + n, _keys.end());
+		_values.erase(_values.begin() + n, _values.end());
+	}
+
+	void	_check_range( size_type n ) const {
+		if (n >= size()) {
+			throw std::out_of_range("soa_vector::at");
+		}
+	}
+
+};
+
+// relational operators
+template <typename T, typename Alloc, typename Growth>
+bool	operator == ( const soa_vector<T, Alloc, Growth> & lhs, const soa_vector<T, Alloc, Growth> & rhs ) {
+	return lhs.size() == rhs.size()
+		&& ft::equal(lhs.keys(), lhs.keys() + lhs.size(), rhs.keys())
+		&& ft::equal(lhs.values(), lhs.values() + lhs.size(), rhs.values());
+}
+
+template <typename T, typename Alloc, typename Growth>
+bool	operator != ( const soa_vector<T, Alloc, Growth> & lhs, const soa_vector<T, Alloc, Growth> & rhs ) { return !(lhs == rhs); }
+
+template <typename T, typename Alloc, typename Growth>
+bool	operator < ( const soa_vector<T, Alloc, Growth> & lhs, const soa_vector<T, Alloc, Growth> & rhs ) {
+	return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename T, typename Alloc, typename Growth>
+bool	operator <= ( const soa_vector<T, Alloc, Growth> & lhs, const soa_vector<T, Alloc, Growth> & rhs ) { return !(rhs < lhs); }
+
+template <typename T, typename Alloc, typename Growth>
+bool	operator > ( const soa_vector<T, Alloc, Growth> & lhs, const soa_vector<T, Alloc, Growth> & rhs ) { return rhs < lhs; }
+
+template <typename T, typename Alloc, typename Growth>
+bool	operator >= ( const soa_vector<T, Alloc, Growth> & lhs, const soa_vector<T, Alloc, Growth> & rhs ) { return !(lhs < rhs); }
+
+// swap
+template <typename T, typename Alloc, typename Growth>
+void	swap( soa_vector<T, Alloc, Growth> & lhs, soa_vector<T, Alloc, Growth> & rhs ) { lhs.swap(rhs); }
+
+// relocation
+template <typename T, typename Alloc, typename Growth>
+struct is_swap_relocatable< soa_vector<T, Alloc, Growth> > : true_type { /* no-op */ };
+
+}
@@ -0,0 +1,527 @@
+#pragma once
+
+#include <algorithm> // swap
+#include <memory> // allocator
+
+#include "iterator.hpp"
+#include "type_traits.hpp"
+#include "algorithm.hpp"
+#include "memory.hpp"
+
+namespace ft {
+
+// ************************************************************************** //
+//                                 iter_swap                                  //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/algorithm/iter_swap
+**
+**	Real references go through swap, so types with a cheap swap (strings,
+**	containers) aren't copied. Proxy references (soa_vector, packed bits) are
+**	swapped through a value_type temporary.
+*/
+
+template <typename Iterator1, typename Iterator2>
+void	_iter_swap( Iterator1 a, Iterator2 b, true_type ) {
+	using std::swap;
+
+	swap(*a, *b);
+} // reference
+
+template <typename Iterator1, typename Iterator2>
+void	_iter_swap( Iterator1 a, Iterator2 b, false_type ) {
+	typename iterator_traits<Iterator1>::value_type	tmp = *a;
+
+	*a = *b;
+	*b = tmp;
+} // proxy
+
+template <typename Iterator1, typename Iterator2>
+void	iter_swap( Iterator1 a, Iterator2 b ) {
+	typedef typename iterator_traits<Iterator1>::value_type	value_type;
+	typedef typename iterator_traits<Iterator1>::reference	reference;
+
+	_iter_swap(a, b, integral_constant<bool, is_same<reference, value_type &>::value>());
+}
+
+
+// ************************************************************************** //
+//                               insertion sort                               //
+// ************************************************************************** //
+
+/*
+**	Used below the introsort cutoff, where the range is nearly sorted.
+*/
+
+// Shifts val left from last until it's in place, never running past the front
+template <typename RandomAccessIterator, typename T, typename Compare>
+void	_unguarded_linear_insert( RandomAccessIterator last, const T & val, Compare comp ) {
+	RandomAccessIterator	next = last;
+
+	--next;
+	while (comp(val, *next)) {
+		*last = *next;
+		last = next;
+		--next;
+	}
+	*last = val;
+}
+
+template <typename RandomAccessIterator, typename Compare>
+void	_insertion_sort( RandomAccessIterator first, RandomAccessIterator last, Compare comp ) {
+	typedef typename iterator_traits<RandomAccessIterator>::value_type	value_type;
+
+	if (first == last) {
+		return ;
+	}
+	for (RandomAccessIterator it = first + 1; it != last; ++it) {
+		value_type	val = *it;
+
+		if (comp(val, *first)) {
+			ft::move_backward(first, it, it + 1);
+			*first = val;
+		} else {
+			_unguarded_linear_insert(it, val, comp);
+		}
+	}
+}
+
+
+// ************************************************************************** //
+//                                   heaps                                    //
+// ************************************************************************** //
+
+/*
+**	Max heaps for partial_sort, and for introsort once it goes too deep.
+*/
+
+// Sifts val down from hole in the heap [first, first + len)
+template <typename RandomAccessIterator, typename Distance, typename T, typename Compare>
+void	_adjust_heap( RandomAccessIterator first, Distance hole, Distance len, T val, Compare comp ) {
+	const Distance	top = hole;
+	Distance		child = hole;
+
+	while (child < (len - 1) / 2) {
+		child = 2 * (child + 1);
+		if (comp(first[child], first[child - 1])) {
+			child--;
+		}
+		first[hole] = first[child];
+		hole = child;
+	}
+	if ((len & 1) == 0 && child == (len - 2) / 2) {
+		child = 2 * (child + 1);
+		first[hole] = first[child - 1];
+		hole = child - 1;
+	}
+	// push val back up
+	Distance	parent = (hole - 1) / 2;
+
+	while (hole > top && comp(first[parent], val)) {
+		first[hole] = first[parent];
+		hole = parent;
+		parent = (hole - 1) / 2;
+	}
+	first[hole] = val;
+}
+
+template <typename RandomAccessIterator, typename Compare>
+void	_make_heap( RandomAccessIterator first, RandomAccessIterator last, Compare comp ) {
+	typedef typename iterator_traits<RandomAccessIterator>::difference_type	difference_type;
+	typedef typename iterator_traits<RandomAccessIterator>::value_type		value_type;
+
+	difference_type	len = last - first;
+
+	if (len < 2) {
+		return ;
+	}
+	for (difference_type parent = (len - 2) / 2; ; parent--) {
+		value_type	val = first[parent];
+
+		_adjust_heap(first, parent, len, val, comp);
+		if (parent == 0) {
+			return ;
+		}
+	}
+}
+
+// Moves the top of the heap [first, last) to result and puts *result in the heap
+template <typename RandomAccessIterator, typename Compare>
+void	_pop_heap( RandomAccessIterator first, RandomAccessIterator last, RandomAccessIterator result, Compare comp ) {
+	typedef typename iterator_traits<RandomAccessIterator>::difference_type	difference_type;
+	typedef typename iterator_traits<RandomAccessIterator>::value_type		value_type;
+
+	value_type	val = *result;
+
+	*result = *first;
+	_adjust_heap(first, difference_type(0), difference_type(last - first), val, comp);
+}
+
+template <typename RandomAccessIterator, typename Compare>
+void	_sort_heap( RandomAccessIterator first, RandomAccessIterator last, Compare comp ) {
+	while (last - first > 1) {
+		--last;
+		_pop_heap(first, last, last, comp);
+	}
+}
+
+// Leaves the smallest middle - first elements of [first, last) in the heap [first, middle)
+template <typename RandomAccessIterator, typename Compare>
+void	_heap_select( RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, Compare comp ) {
+	_make_heap(first, middle, comp);
+	for (RandomAccessIterator it = middle; it < last; ++it) {
+		if (comp(*it, *first)) {
+			_pop_heap(first, middle, it, comp);
+		}
+	}
+}
+
+
+// ************************************************************************** //
+//                                partitioning                                //
+// ************************************************************************** //
+
+template <typename Iterator, typename Compare>
+void	_move_median_to_first( Iterator result, Iterator a, Iterator b, Iterator c, Compare comp ) {
+	if (comp(*a, *b)) {
+		if (comp(*b, *c)) {
+			ft::iter_swap(result, b);
+		} else if (comp(*a, *c)) {
+			ft::iter_swap(result, c);
+		} else {
+			ft::iter_swap(result, a);
+		}
+	} else if (comp(*a, *c)) {
+		ft::iter_swap(result, a);
+	} else if (comp(*b, *c)) {
+		ft::iter_swap(result, c);
+	} else {
+		ft::iter_swap(result, b);
+	}
+}
+
+/*
+**	Hoare partition of [first, last) around *pivot, which sits outside the
+**	range. The pivot stops both scans so they need no bounds checks.
+*/
+template <typename RandomAccessIterator, typename Compare>
+RandomAccessIterator	_unguarded_partition( RandomAccessIterator first, RandomAccessIterator last,
+											  RandomAccessIterator pivot, Compare comp ) {
+	while (true) {
+		while (comp(*first, *pivot)) {
+			++first;
+		}
+		--last;
+		while (comp(*pivot, *last)) {
+			--last;
+		}
+		if (!(first < last)) {
+			return first;
+		}
+		ft::iter_swap(first, last);
+		++first;
+	}
+}
+
+// Median of three pivot moved to *first, returns the start of the right part
+template <typename RandomAccessIterator, typename Compare>
+RandomAccessIterator	_partition_pivot( RandomAccessIterator first, RandomAccessIterator last, Compare comp ) {
+	RandomAccessIterator	mid = first + (last - first) / 2;
+
+	_move_median_to_first(first, first + 1, mid, last - 1, comp);
+	return _unguarded_partition(first + 1, last, first, comp);
+}
+
+// 2 * floor(log2(n)), the depth after which introsort gives up on quicksort
+template <typename Size>
+Size	_depth_limit( Size n ) {
+	Size	depth = 0;
+
+	for (; n > 1; n >>= 1) {
+		depth++;
+	}
+	return depth * 2;
+}
+
+
+// ************************************************************************** //
+//                                    sort                                    //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/algorithm/sort
+**
+**	Introsort: quicksort with a median of three pivot, switching to heapsort
+**	when the recursion goes deeper than 2 log2(n), and leaving ranges shorter
+**	than _sort_threshold to a final insertion sort.
+**
+**	Contiguous ranges of integers sorted with operator< go through an LSD
+**	radix sort instead.
+*/
+
+enum { _sort_threshold = 16, _radix_threshold = 256 };
+
+template <typename RandomAccessIterator, typename Size, typename Compare>
+void	_introsort_loop( RandomAccessIterator first, RandomAccessIterator last, Size depth_limit, Compare comp ) {
+	while (last - first > _sort_threshold) {
+		if (depth_limit == 0) {
+			_heap_select(first, last, last, comp);
+			_sort_heap(first, last, comp);
+			return ;
+		}
+		--depth_limit;
+
+		RandomAccessIterator	cut = _partition_pivot(first, last, comp);
+
+		_introsort_loop(cut, last, depth_limit, comp);
+		last = cut;
+	}
+}
+
+template <typename RandomAccessIterator, typename Compare>
+void	_final_insertion_sort( RandomAccessIterator first, RandomAccessIterator last, Compare comp ) {
+	if (last - first <= _sort_threshold) {
+		_insertion_sort(first, last, comp);
+		return ;
+	}
+	// the first block holds the minimum, later inserts can't run past it
+	_insertion_sort(first, first + _sort_threshold, comp);
+	for (RandomAccessIterator it = first + _sort_threshold; it != last; ++it) {
+		typename iterator_traits<RandomAccessIterator>::value_type	val = *it;
+
+		_unguarded_linear_insert(it, val, comp);
+	}
+}
+
+template <typename RandomAccessIterator, typename Compare>
+void	_introsort( RandomAccessIterator first, RandomAccessIterator last, Compare comp ) {
+	if (last - first < 2) {
+		return ;
+	}
+	_introsort_loop(first, last, _depth_limit(last - first), comp);
+	_final_insertion_sort(first, last, comp);
+}
+
+// Byte `shift / 8` of x, the sign bit flipped on the top byte of signed types
+template <typename T>
+size_t	_radix_key( T x, size_t shift ) {
+	const bool	flip = T(-1) < T(0) && shift + 8 == sizeof(T) * 8;
+
+	return ((x >> shift) & 0xff) ^ (flip ? 0x80 : 0);
+}
+
+template <typename T>
+void	_radix_sort( T * first, T * last ) {
+	const size_t		n = last - first;
+	std::allocator<T>	alloc;
+	T *					buffer = alloc.allocate(n);
+	T *					src = first;
+	T *					dest = buffer;
+
+	for (size_t shift = 0; shift < sizeof(T) * 8; shift += 8) {
+		size_t	offsets[256] = {};
+
+		for (T * it = src; it != src + n; ++it) {
+			offsets[_radix_key(*it, shift)]++;
+		}
+		if (offsets[_radix_key(*src, shift)] == n) {
+			continue ; // every key has the same byte here
+		}
+		for (size_t i = 0, sum = 0; i < 256; i++) {
+			size_t	count = offsets[i];
+
+			offsets[i] = sum;
+			sum += count;
+		}
+		for (T * it = src; it != src + n; ++it) {
+			dest[offsets[_radix_key(*it, shift)]++] = *it;
+		}
+		std::swap(src, dest);
+	}
+	if (src != first) {
+		ft::copy(src, src + n, first);
+	}
+	alloc.deallocate(buffer, n);
+}
+
+template <typename RandomAccessIterator>
+void	_sort( RandomAccessIterator first, RandomAccessIterator last, false_type ) {
+	_introsort(first, last, _iter_less());
+} // comparisons
+
+template <typename T>
+void	_sort( T * first, T * last, true_type ) {
+	if (last - first < _radix_threshold) {
+		_introsort(first, last, _iter_less());
+	} else {
+		_radix_sort(first, last);
+	}
+} // radix
+
+template <typename Iterator>
+false_type	_radix_sortable( Iterator ) { return false_type(); }
+
+template <typename T>
+integral_constant<bool, is_integral<T>::value && !is_same<T, bool>::value>	_radix_sortable( T * ) {
+	return integral_constant<bool, is_integral<T>::value && !is_same<T, bool>::value>();
+}
+
+template <typename RandomAccessIterator>
+void	sort( RandomAccessIterator first, RandomAccessIterator last ) {
+	_sort(_unwrap(first), _unwrap(last), _radix_sortable(_unwrap(first)));
+}
+
+template <typename RandomAccessIterator, typename Compare>
+void	sort( RandomAccessIterator first, RandomAccessIterator last, Compare comp ) {
+	_introsort(first, last, comp);
+}
+
+
+// ************************************************************************** //
+//                                stable_sort                                 //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/algorithm/stable_sort
+**
+**	Bottom up merge sort: runs of _sort_threshold elements are insertion
+**	sorted in place, then merged back and forth between the range and a
+**	buffer of the same length.
+*/
+
+// Merges two sorted runs into dest, taking from the left run on ties
+template <typename Iterator1, typename Iterator2, typename Compare>
+Iterator2	_merge_runs( Iterator1 first1, Iterator1 last1, Iterator1 first2, Iterator1 last2,
+						 Iterator2 dest, Compare comp ) {
+	for (; first1 != last1 && first2 != last2; ++dest) {
+		if (comp(*first2, *first1)) {
+			*dest = *first2;
+			++first2;
+		} else {
+			*dest = *first1;
+			++first1;
+		}
+	}
+	return ft::copy(first2, last2, ft::copy(first1, last1, dest));
+}
+
+// Merges every pair of runs of length `run` from [first, last) into dest
+template <typename Iterator1, typename Iterator2, typename Distance, typename Compare>
+void	_merge_pass( Iterator1 first, Iterator1 last, Iterator2 dest, Distance run, Compare comp ) {
+	while (last - first >= 2 * run) {
+		dest = _merge_runs(first, first + run, first + run, first + 2 * run, dest, comp);
+		first += 2 * run;
+	}
+	Distance	middle = last - first < run ? last - first : run;
+
+	_merge_runs(first, first + middle, first + middle, last, dest, comp);
+}
+
+template <typename RandomAccessIterator, typename Compare>
+void	_stable_sort( RandomAccessIterator first, RandomAccessIterator last, Compare comp ) {
+	typedef typename iterator_traits<RandomAccessIterator>::difference_type	difference_type;
+	typedef typename iterator_traits<RandomAccessIterator>::value_type		value_type;
+
+	const difference_type	n = last - first;
+
+	if (n <= _sort_threshold) {
+		_insertion_sort(first, last, comp);
+		return ;
+	}
+	for (RandomAccessIterator it = first; it < last; it += _sort_threshold) {
+		_insertion_sort(it, last - it < _sort_threshold ? last : it + _sort_threshold, comp);
+	}
+
+	std::allocator<value_type>	alloc;
+	value_type *				buffer = alloc.allocate(n);
+
+	ft::uninitialized_copy(first, last, buffer, alloc);
+	for (difference_type run = _sort_threshold; run < n; run *= 4) {
+		_merge_pass(first, last, buffer, run, comp);
+		if (run * 2 >= n) {
+			ft::copy(buffer, buffer + n, first);
+			break ;
+		}
+		_merge_pass(buffer, buffer + n, first, run * 2, comp);
+	}
+	ft::destroy(buffer, buffer + n, alloc);
+	alloc.deallocate(buffer, n);
+}
+
+template <typename RandomAccessIterator>
+void	stable_sort( RandomAccessIterator first, RandomAccessIterator last ) {
+	_stable_sort(first, last, _iter_less());
+}
+
+template <typename RandomAccessIterator, typename Compare>
+void	stable_sort( RandomAccessIterator first, RandomAccessIterator last, Compare comp ) {
+	_stable_sort(first, last, comp);
+}
+
+
+// ************************************************************************** //
+//                                partial_sort                                //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/algorithm/partial_sort
+*/
+
+template <typename RandomAccessIterator, typename Compare>
+void	partial_sort( RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last,
+					  Compare comp ) {
+	_heap_select(first, middle, last, comp);
+	_sort_heap(first, middle, comp);
+}
+
+template <typename RandomAccessIterator>
+void	partial_sort( RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last ) {
+	ft::partial_sort(first, middle, last, _iter_less());
+}
+
+
+// ************************************************************************** //
+//                                nth_element                                 //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/algorithm/nth_element
+**
+**	Introselect: quickselect with the same pivot and depth limit as sort.
+*/
+
+template <typename RandomAccessIterator, typename Compare>
+void	nth_element( RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last,
+					 Compare comp ) {
+	if (first == last || nth == last) {
+		return ;
+	}
+
+	typename iterator_traits<RandomAccessIterator>::difference_type	depth_limit = _depth_limit(last - first);
+
+	while (last - first > 3) {
+		if (depth_limit == 0) {
+			_heap_select(first, nth + 1, last, comp);
+			ft::iter_swap(first, nth); // the top of the heap is the nth smallest
+			return ;
+		}
+		--depth_limit;
+
+		RandomAccessIterator	cut = _partition_pivot(first, last, comp);
+
+		if (cut <= nth) {
+			first = cut;
+		} else {
+			last = cut;
+		}
+	}
+	_insertion_sort(first, last, comp);
+}
+
+template <typename RandomAccessIterator>
+void	nth_element( RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last ) {
+	ft::nth_element(first, nth, last, _iter_less());
+}
+
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <list>
+#include <numeric>
+
+#include "macros.hpp"
+
+#if defined(STL)
+	# include <vector>
+	namespace ft = std;
+#else
+	# include "algorithm.hpp"
+	# include "sort.hpp"
+	# include "search.hpp"
+	# include "parallel.hpp"
+	# include "vector.hpp"
+#endif
+
+typedef ft::vector<unsigned char>	ByteVector;
+typedef ft::vector<int>				IntVector;
+typedef std::string					Algorithm_t;
+
+void	algorithm_tests( void );
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "macros.hpp"
+
+#if defined(STL)
+	# include <deque>
+	# include <vector>
+	# include <algorithm>
+	namespace ft = std;
+#else
+	# include "deque.hpp"
+	# include "vector.hpp"
+#endif
+
+template <typename T>
+void	print_deque(T& d) {
+	COUT("[");
+	if (d.empty()) {
+		LOG("]");
+	} else if (d.size() <= MAX_PRINT) {
+		for (typename T::iterator it = d.begin(); it != d.end() - 1; it++) {
+			COUT(*it << ", ");
+		}
+		LOG(d.back() << "]");
+	} else {
+		typename T::iterator	end = d.begin() + MAX_PRINT;
+		for (typename T::iterator it = d.begin(); it != end; it++) {
+			COUT(*it << ", ");
+		}
+		LOG(" ... Deque longer then 50 elements");
+	}
+}
+
+template <typename T>
+void	print_metrics_deque(T& d) {
+	LOG("Size: " << d.size());
+	if (d.size() != static_cast<size_t>(d.end() - d.begin())) {
+		throw("Size doesn't match the iterators!");
+	}
+}
+
+typedef std::string				Deque_t;
+
+typedef ft::deque<Deque_t>				Deque;
+typedef ft::deque<Deque_t>::iterator	Deque_it;
+typedef ft::deque<int>					DequeInt;
+
+void	deque_tests( void );
@@ -1,12 +1,14 @@
 #pragma once
 
 #include "macros.hpp"
+#include "convert.hpp"
 
 #if defined(STL)
 	# include <map>
 	namespace ft = std;
 #else
 	# include "map.hpp"
+	# include "pool_allocator.hpp"
 #endif
 
 template <typename T>
@@ -33,5 +35,11 @@ typedef Map::iterator			Map_it;
 typedef Map::value_type			Pair;
 typedef std::allocator<Pair>	Map_allo;
 
+#if defined(STL)
+	typedef ft::map<Map_t, Map_t>	PoolMap;
+#else
+	typedef ft::map<Map_t, Map_t, std::less<Map_t>, ft::pool_allocator<Pair> >	PoolMap;
+#endif
+
 void	map_tests( void );
 
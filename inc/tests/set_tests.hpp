@@ -32,5 +32,19 @@ typedef ft::set<Set_t>			Set;
 typedef Set::iterator			Set_it;
 typedef std::allocator<Set_t>	Set_allo;
 
+// A key type without a default constructor
+struct Version {
+	int	major;
+	int	minor;
+
+	Version( int major, int minor ) : major(major), minor(minor) { /* no-op */ }
+
+	bool	operator < ( const Version & rhs ) const {
+		return major < rhs.major || (major == rhs.major && minor < rhs.minor);
+	}
+};
+
+inline std::ostream &	operator << ( std::ostream & o, const Version & v ) { return o << v.major << "." << v.minor; }
+
 void	set_tests( void );
 
@@ -2,22 +2,29 @@
 
 #include "macros.hpp"
 
-# include <deque>
 # include <list>
 
 #if defined(STL)
 	# include <stack>
 	# include <vector>
+	# include <deque>
 	namespace ft = std;
 #else
 	# include "stack.hpp"
+	# include "small_vector.hpp"
+	# include "deque.hpp"
 #endif
 
 typedef std::string	Stack_t;
 
 typedef ft::stack< Stack_t >						StackVector;
-typedef ft::stack< Stack_t, std::deque<Stack_t> >	StackDeque;
+typedef ft::stack< Stack_t, ft::deque<Stack_t> >	StackDeque;
 typedef ft::stack< Stack_t, std::list<Stack_t> >	StackList;
+#if defined(STL)
+typedef ft::stack< Stack_t, std::vector<Stack_t> >	StackSmallVector;
+#else
+typedef ft::stack< Stack_t, ft::small_vector<Stack_t, 8> >	StackSmallVector;
+#endif
 
 template <typename T, typename Container>
 class IterableStack : public ft::stack<T, Container>
@@ -1,12 +1,29 @@
 #pragma once
 
+#include <sys/stat.h>
+#include <unistd.h>
+#include <stdint.h> // uintptr_t
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <list>
+#include <stdexcept>
+
 #include "macros.hpp"
 
 #if defined(STL)
 	# include <vector>
+	# include <algorithm>
+	# include <utility>
 	namespace ft = std;
 #else
 	# include "vector.hpp"
+	# include "soa_vector.hpp"
+	# include "sort.hpp"
+	# include "mmap_allocator.hpp"
+	# include "small_vector.hpp"
+	# include "mapped_vector.hpp"
+	# include "aligned_allocator.hpp"
 #endif
 
 template <typename T>
@@ -41,4 +58,85 @@ typedef ft::vector<Vector_t>			Vector;
 typedef ft::vector<Vector_t>::iterator	Vector_it;
 typedef std::allocator<Vector_t>		Vector_allo;
 
+typedef ft::pair<int, Vector_t>			Row;
+#if defined(STL)
+	typedef std::vector<Row>			SoaVector;
+#else
+	typedef ft::soa_vector<Row>			SoaVector;
+#endif
+
+typedef ft::vector<bool>				BoolVector;
+
+// 12 bytes: does not divide a page
+struct Rgb {
+	int	r, g, b;
+};
+
+#if !defined(STL)
+	typedef ft::vector< int, std::allocator<int>, ft::factor_growth<2, 1> >		GrowthDouble;
+	typedef ft::vector< int, std::allocator<int>, ft::factor_growth<3, 2> >		GrowthHalf;
+	typedef ft::vector< int, std::allocator<int>, ft::page_growth<4096> >		GrowthPage;
+	typedef ft::vector< Rgb, std::allocator<Rgb>, ft::page_growth<4096> >		GrowthPageRgb;
+#endif
+
+#define ALIGNMENT 64
+#if defined(STL)
+	typedef std::vector<float>										AlignedVector;
+#else
+	typedef ft::vector< float, ft::aligned_allocator<float, ALIGNMENT> >	AlignedVector;
+#endif
+
+// std has no aligned allocator to hold against, its side always passes
+template <typename T>
+bool	is_aligned( const T & v ) {
+#if defined(STL)
+	(void)v;
+	return true;
+#else
+	return reinterpret_cast<uintptr_t>(v.data()) % ALIGNMENT == 0 && v.aligned_data() == v.data();
+#endif
+}
+
+#define SMALL_N 4
+#if defined(STL)
+	typedef std::vector<Vector_t>					SmallVector;
+#else
+	typedef ft::small_vector<Vector_t, SMALL_N>		SmallVector;
+#endif
+
+/*
+**	std::vector has no inline storage: a capacity that fits in SMALL_N stands
+**	for it, as long as the std side reserves SMALL_N where ft starts inline.
+*/
+template <typename T>
+void	print_small( const T & v ) {
+	COUT("[");
+	for (size_t i = 0; i < v.size(); i++) {
+		COUT((i ? ", " : "") << v[i]);
+	}
+#if defined(STL)
+	bool	is_inline = v.capacity() <= SMALL_N;
+#else
+	bool	is_inline = v.is_inline();
+#endif
+	LOG("] (" << v.size() << ", " << (is_inline ? "inline" : "heap") << ")");
+}
+
+template <typename T>
+void	print_bits( const T & v ) {
+	for (size_t i = 0; i < v.size(); i++) {
+		COUT(v[i]);
+	}
+	LOG(" (" << v.size() << ")");
+}
+
+template <typename T>
+void	print_rows( T & v ) {
+	COUT("[");
+	for (size_t i = 0; i < v.size(); i++) {
+		COUT((i ? ", " : "") << v[i].first << ":" << v[i].second);
+	}
+	LOG("]");
+}
+
 void	vector_tests( void );
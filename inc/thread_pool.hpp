@@ -0,0 +1,221 @@
+#pragma once
+
+#include <pthread.h>
+#include <unistd.h>
+#include <cstddef> // size_t
+#include <cstring> // strerror
+#include <stdexcept>
+#include <string>
+
+#include "vector.hpp"
+
+namespace ft {
+
+// ************************************************************************** //
+//                               thread_pool class                            //
+// ************************************************************************** //
+
+/*
+**	A fixed set of pthreads running batches of indexed tasks: run(task,
+**	context, count) calls task(context, i) for every i in [0, count) and
+**	returns once they have all finished. The calling thread works on the batch
+**	too, so a pool of n threads starts n - 1 workers.
+**
+**	Tasks are claimed one at a time with an atomic counter, so uneven tasks
+**	balance themselves. One batch runs at a time: a second caller waits its
+**	turn, and a task that runs a batch on its own pool runs it serially.
+**
+**	An exception thrown by a task on the calling thread is rethrown once the
+**	workers are done; one thrown on a worker becomes a std::runtime_error.
+*/
+
+class thread_pool {
+
+public:
+	typedef void	(*task_type)( void * context, size_t index );
+
+	/* Constructors */
+	explicit thread_pool( size_t threads = hardware_concurrency() )
+		: _task(NULL), _context(NULL), _count(0), _next(0), _generation(0),
+		  _active(0), _running(false), _failed(false), _stop(false) {
+		pthread_mutex_init(&_lock, NULL);
+		pthread_cond_init(&_wake, NULL);
+		pthread_cond_init(&_done, NULL);
+		_workers.reserve(threads > 1 ? threads - 1 : 0);
+		for (size_t i = 1; i < threads; i++) {
+			pthread_t	thread;
+			int			error = pthread_create(&thread, NULL, &thread_pool::_worker, this);
+
+			if (error) {
+				_join();
+				throw std::runtime_error(std::string("thread_pool: pthread_create: ") + std::strerror(error));
+			}
+			_workers.push_back(thread);
+		}
+	}
+
+	~thread_pool( void ) { _join(); }
+
+	/* Capacity */
+	size_t	size( void ) const { return _workers.size() + 1; } // with the calling thread
+
+	static size_t	hardware_concurrency( void ) {
+		long	n = ::sysconf(_SC_NPROCESSORS_ONLN);
+
+		return n > 0 ? static_cast<size_t>(n) : 1;
+	}
+
+	// One pool per process, one thread per core, started on first use
+	static thread_pool &	shared( void ) {
+		static thread_pool	pool;
+
+		return pool;
+	}
+
+	/* Operations */
+	void	run( task_type task, void * context, size_t count ) {
+		if (_workers.empty() || count < 2 || _current() == this) {
+			for (size_t i = 0; i < count; i++) {
+				task(context, i);
+			}
+			return ;
+		}
+
+		pthread_mutex_lock(&_lock);
+		while (_running || _active) {
+			pthread_cond_wait(&_done, &_lock);
+		}
+		_running = true;
+		_failed = false;
+		_task = task;
+		_context = context;
+		_count = count;
+		_next = 0;
+		_generation++;
+		pthread_cond_broadcast(&_wake);
+		pthread_mutex_unlock(&_lock);
+
+		try {
+			_drain(task, context, count);
+		} catch (...) {
+			_finish();
+			throw;
+		}
+		if (_finish()) {
+			throw std::runtime_error("thread_pool: a task threw on a worker thread");
+		}
+	}
+
+private:
+	ft::vector<pthread_t>	_workers;
+	pthread_mutex_t			_lock;
+	pthread_cond_t			_wake; // a batch started, or the pool stops
+	pthread_cond_t			_done; // a worker went idle, or a batch ended
+
+	// The batch being run, guarded by _lock except _next
+	task_type				_task;
+	void *					_context;
+	size_t					_count;
+	volatile size_t			_next; // next unclaimed index
+	unsigned long			_generation;
+	size_t					_active; // workers inside the batch
+	bool					_running;
+	bool					_failed;
+	bool					_stop;
+
+	thread_pool( const thread_pool & );
+	thread_pool &	operator = ( const thread_pool & );
+
+	// The pool whose task the current thread is running, if any
+	static const thread_pool *&	_current( void ) {
+		static __thread const thread_pool *	current = NULL;
+
+		return current;
+	}
+
+	void	_drain( task_type task, void * context, size_t count ) {
+		const thread_pool *	outer = _current();
+
+		_current() = this;
+		try {
+			for (size_t i; (i = __sync_fetch_and_add(&_next, 1)) < count; ) {
+				task(context, i);
+			}
+		} catch (...) {
+			_current() = outer;
+			throw;
+		}
+		_current() = outer;
+	}
+
+	// Waits for the workers to leave the batch, returns whether one of them failed
+	bool	_finish( void ) {
+		bool	failed;
+
+		pthread_mutex_lock(&_lock);
+		while (_active) {
+			pthread_cond_wait(&_done, &_lock);
+		}
+		_running = false;
+		failed = _failed;
+		pthread_cond_broadcast(&_done);
+		pthread_mutex_unlock(&_lock);
+		return failed;
+	}
+
+	static void *	_worker( void * pool ) {
+		static_cast<thread_pool *>(pool)->_work();
+		return NULL;
+	}
+
+	void	_work( void ) {
+		unsigned long	seen = 0;
+
+		pthread_mutex_lock(&_lock);
+		for (;;) {
+			while (!_stop && (!_running || _generation == seen)) {
+				pthread_cond_wait(&_wake, &_lock);
+			}
+			if (_stop) {
+				break ;
+			}
+			seen = _generation;
+			_active++;
+
+			task_type	task = _task;
+			void *		context = _context;
+			size_t		count = _count;
+
+			pthread_mutex_unlock(&_lock);
+			bool	failed = false;
+			try {
+				_drain(task, context, count);
+			} catch (...) {
+				failed = true;
+			}
+			pthread_mutex_lock(&_lock);
+			_failed |= failed;
+			if (--_active == 0) {
+				pthread_cond_broadcast(&_done);
+			}
+		}
+		pthread_mutex_unlock(&_lock);
+	}
+
+	void	_join( void ) {
+		pthread_mutex_lock(&_lock);
+		_stop = true;
+		pthread_cond_broadcast(&_wake);
+		pthread_mutex_unlock(&_lock);
+		for (size_t i = 0; i < _workers.size(); i++) {
+			pthread_join(_workers[i], NULL);
+		}
+		_workers.clear();
+		pthread_cond_destroy(&_done);
+		pthread_cond_destroy(&_wake);
+		pthread_mutex_destroy(&_lock);
+	}
+
+};
+
+}
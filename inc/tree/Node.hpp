@@ -1,145 +1,123 @@
 #pragma once
 
+#include <cstddef> // NULL
+
 // Enumeration for the color of a node
 enum Color { RED, BLACK };
 
 namespace ft {
 
+// ************************************************************************** //
+//                                 NodeBase                                   //
+// ************************************************************************** //
+
+/*
+**	The links of a node, without its data. The tree embeds one as its header:
+**	the header is end(), its parent is the root (and the root's parent is the
+**	header), its left and right links are the leftmost and rightmost nodes.
+**	Leaves are NULL.
+**
+**	The header is the only red node whose grandparent is itself (or with no
+**	parent, in an empty tree), which is how stepping back from end()
+**	recognizes it.
+*/
+struct NodeBase {
+	typedef NodeBase *	base_pointer;
+
+	Color			color;
+	base_pointer	left, right, parent;
+
+	NodeBase( void ) : color(RED), left(NULL), right(NULL), parent(NULL) { /* no-op */ }
+};
+
 // ************************************************************************** //
 //                               Node template	                              //
 // ************************************************************************** //
 
 // Struct for a node in the tree
 template <typename T>
-struct Node {
+struct Node : public NodeBase {
 	typedef	T					value_type;
 	typedef	value_type &		value_reference;
 	typedef	Node<value_type>	node_type;
 	typedef	node_type *			node_pointer;
 
 	value_type		data;
-	Color 			color;
-	node_pointer	left, right, parent;
-
-	Node( value_type data )
-		: data(data)
-		, color(RED)
-		, left(NULL)
-		, right(NULL)
-		, parent(NULL) { /* no-op */ };
+
+	Node( const value_type & data ) : NodeBase(), data(data) { /* no-op */ };
 };
 
-template <typename T>
-bool	is_leaf_node( Node<T> * node ) { return node && node->left == NULL; }
+inline bool	is_left_child( NodeBase * node ) { return node->parent->left == node; }
 
-template <typename T>
-bool	is_left_child( Node<T> * node ) { return node->parent->left == node; }
+inline bool	is_right_child( NodeBase * node ) { return !is_left_child(node); }
 
-template <typename T>
-bool	is_right_child( Node<T> * node ) { return !is_left_child(node); }
+inline bool	is_black( NodeBase * node ) { return !node || node->color == BLACK; }
 
-template <typename T>
-bool	is_black( Node<T> * node ) { return !node || node->color == BLACK; }
+inline bool	is_red( NodeBase * node ) { return !is_black(node); }
 
-template <typename T>
-bool	is_red( Node<T> * node ) { return !is_black(node); }
+inline bool	is_header( NodeBase * node ) {
+	return node->color == RED && (!node->parent || node->parent->parent == node);
+}
 
-template <typename T>
-Node<T> *	leftmost_node( Node<T> * node ) {
+inline NodeBase *	leftmost_node( NodeBase * node ) {
 	if (!node) {
 		return NULL;
 	}
 
-	while (!is_leaf_node(node->left)) {
+	while (node->left) {
 		node = node->left;
 	}
 	return node;
 }
 
-template <typename T>
-Node<T> *	rightmost_node( Node<T> * node ) {
+inline NodeBase *	rightmost_node( NodeBase * node ) {
 	if (!node) {
 		return NULL;
 	}
 
-	while (!is_leaf_node(node->right)) {
+	while (node->right) {
 		node = node->right;
 	}
 	return node;
 }
 
-template <typename T>
-Node<T> *	upmost_node( Node<T> * node ) {
-	while (node && node->parent) {
-		node = node->parent;
-	}
-	return node;
-}
-
-template <typename T>
-Node<T> *	upmost_right_node( Node<T> * node ) {
-	if (!node) {
-		return NULL;
-	}
+/*
+**	Stepping only follows links, never restarts from the root: a full scan
+**	crosses every edge twice, so a step is amortized O(1) both ways.
+*/
 
-	while (node->parent && node->parent->right == node) {
-		node = node->parent;
+// The in-order successor, the header after the rightmost node
+inline NodeBase *	increment( NodeBase * node ) {
+	if (node->right) {
+		return leftmost_node(node->right);
 	}
-	node = node->parent;
-	return node;
-}
 
-template <typename T>
-Node<T> *	upmost_left_node( Node<T> * node ) {
-	if (!node) {
-		return NULL;
-	}
+	NodeBase *	parent = node->parent;
 
-	while (node->parent && node->parent->left == node) {
-		node = node->parent;
+	while (node == parent->right) {
+		node = parent;
+		parent = parent->parent;
 	}
-	node = node->parent;
-	return node;
+	// Climbing from the rightmost node when it is the root ends on the header
+	return node->right != parent ? parent : node;
 }
 
-template <typename T>
-Node<T> *	increment( Node<T> * node ) {
-	if (!node) {
-		return NULL;
+// The in-order predecessor, the rightmost node before the header
+inline NodeBase *	decrement( NodeBase * node ) {
+	if (is_header(node)) {
+		return node->right;
 	}
-
-	if (is_leaf_node(node)) {
-		if (node->parent) {
-			node = leftmost_node(upmost_node(node));
-		}
-	} else if (!is_leaf_node(node->right)) {
-		node = leftmost_node(node->right);
-	} else if (node->right->parent == node) {
-		node = node->right;
-	} else {
-		node = upmost_right_node(node);
+	if (node->left) {
+		return rightmost_node(node->left);
 	}
-	return node;
-}
 
-template <typename T>
-Node<T> *	decrement( Node<T> * node ) {
-	if (!node) {
-		return NULL;
-	}
+	NodeBase *	parent = node->parent;
 
-	if (is_leaf_node(node)) {
-		if (node->parent) {
-			node = node->parent;
-		}
-	} else if (!is_leaf_node(node->left)) {
-		node = rightmost_node(node->left);
-	} else if (node == leftmost_node(upmost_node(node))) {
-		node = node->left;
-	} else {
-		node = upmost_left_node(node);
+	while (node == parent->left) {
+		node = parent;
+		parent = parent->parent;
 	}
-	return node;
+	return parent;
 }
 
 }
@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "macros.hpp"
+#include "memory.hpp" // allocator_can_release, swap_allocators
 #include "tree/Node.hpp"
 #include "iterators/TreeIterator.hpp"
 #include "utility.hpp" // pair
@@ -47,34 +48,23 @@ public:
 	typedef typename Allocator::template rebind<node_type>::other		node_allocator_type;
 
 private:
+	typedef NodeBase *										base_pointer;
 
 	/* Member variables */
-	node_pointer		_root, nil;
+	NodeBase			_header;
 	/*
-		The `nil` node is used as the leaf nodes in the tree and it helps simplify some of the tree
-		operations by eliminating the need to check for null pointers.
+		The header is the sentinel of the tree and lives in the tree itself. It holds links and no
+		value: its parent is the root (the root's parent is the header), its left and right links
+		the leftmost and rightmost nodes, and end() points to it. Leaves are NULL.
 
-		It's important to note that the `nil` node should be created once and it should be used throughout
-		the lifetime of the tree.
+		Inserting or erasing updates the leftmost and rightmost nodes in place (rotations keep the
+		order, so they never change them): begin() and rbegin() don't descend the tree.
 
-		A sentinel node serves as a placeholder for null pointers in the tree. Instead of using null
-		pointers, the tree uses the sentinel node as the leaf nodes.
+		Since the header carries no value_type, an empty tree allocates nothing and value_type
+		doesn't need a default constructor. Every node in the heap holds an element.
 
-		The use of a sentinel node eliminates the need to check for null pointers in many of the tree
-		operations, such as insertions and deletions. This makes the code simpler and more efficient, by
-		avoiding the need to check for null pointers in many cases.
-
-		It also helps to simplify the implementation of some of the methods of the Red-Black Tree, such as
-		the minimum and maximum methods, because the tree is guaranteed to have a certain structure, and the
-		nil node is guaranteed to be a leaf node, the implementation of these methods can be simplified by
-		assuming that the tree has this structure.
-
-		In addition, using a sentinel node also makes it easy to implement the successor and predecessor
-		methods, as you don't need to check for the end of the tree, because you know that the nil is always
-		the leaf node.
-
-		It's also worth mentioning that it makes it easier to implement the tree traversals, because it
-		eliminates the need to check for null pointers during the traversal.
+		Only the root points back to the header, so swapping two trees exchanges their headers and
+		fixes that one link.
 	*/
 	size_type			_size;
 	value_compare		compare;
@@ -84,23 +74,21 @@ public:
 	/* Constructors */
 	explicit Tree( const value_compare & comp = value_compare(),
 				   const node_allocator_type & alloc = node_allocator_type() )
-	: _root(NULL), nil(NULL), _size(0), compare(comp), allocator(alloc) { nil_create(); } // default
+	: _header(), _size(0), compare(comp), allocator(alloc) { header_reset(); } // default
 
 	template <class InputIterator>
 	Tree( InputIterator first,
 		  InputIterator last,
 		  const value_compare & comp = value_compare(),
-		  const node_allocator_type & alloc = node_allocator_type() ) : compare(comp), allocator(alloc) {
-		nil_create();
-		while (first != last) {
-			insert(*first);
-			first++;
-		}
+		  const node_allocator_type & alloc = node_allocator_type() )
+		: _header(), _size(0), compare(comp), allocator(alloc) {
+		header_reset();
+		insert(first, last);
 	} // range
 
 	Tree( tree_type const & tree )
-		: _root(NULL), nil(NULL), _size(0), compare(tree.compare), allocator(tree.allocator) {
-		nil_create();
+		: _header(), _size(0), compare(tree.compare), allocator(tree.allocator) {
+		header_reset();
 		insert(tree.begin(), tree.end());
 	} // copy
 
@@ -108,30 +96,28 @@ public:
 	Tree &	operator = ( tree_type const & tree ) {
 		if (this != &tree) {
 			clear();
-			nil_destroy();
 			compare = tree.compare;
 			allocator = tree.allocator;
-			nil_create();
 			insert(tree.begin(), tree.end());
 		}
 		return *this;
 	}
 
 	/* Destructor */
-	~Tree( void ) { clear(); nil_destroy(); }
+	~Tree( void ) { clear(); }
 
 	/* Iterators */
-	iterator			begin( void ) { return _root ? iterator(leftmost_node(_root)) : end(); }
-	const_iterator		begin( void ) const { return _root ? const_iterator(leftmost_node(_root)) : end(); }
-	iterator			end( void ) { return iterator(nil); }
-	const_iterator		end( void ) const { return const_iterator(nil); }
+	iterator			begin( void ) { return iterator(_header.left); }
+	const_iterator		begin( void ) const { return const_iterator(_header.left); }
+	iterator			end( void ) { return iterator(_end()); }
+	const_iterator		end( void ) const { return const_iterator(_end()); }
 	reverse_iterator		rbegin( void ) { return reverse_iterator(--end()); }
 	const_reverse_iterator	rbegin( void ) const { return const_reverse_iterator(--end()); }
 	reverse_iterator		rend( void ) { return reverse_iterator(end()); }
 	const_reverse_iterator	rend( void ) const { return const_reverse_iterator(end()); }
 
 	/* Getters */
-	const_iterator	root( void ) const { return const_iterator(_root); }
+	const_iterator	root( void ) const { return const_iterator(_root()); }
 	size_type		size( void ) const { return _size; }
 	size_type		max_size( void ) const { return allocator.max_size(); }
 	node_allocator_type	get_allocator( void ) const { return allocator; }
@@ -145,20 +131,43 @@ public:
 		}
 	} // range
 
+	// Like insert_unique, lets a failed allocation propagate
 	pair<iterator, bool>	insert( const_reference data ) {
-		node_pointer	node = NULL;
-
-		try {
-			node = node_create(data);
-		} catch (std::bad_alloc &e) {
-			return ft::make_pair(lower_bound(data), false);
-		}
+		node_pointer	node = node_create(data);
 
 		insert(node);
 
 		return ft::make_pair(iterator(node), true);
 	} // single element
 
+	/*
+		Inserts data unless an equal element is already there, in a single descent: the parent
+		and side found on the way down also give the only candidate for an equal element (the
+		parent, or its predecessor when going left). The node is only allocated for a new key.
+	*/
+	pair<iterator, bool>	insert_unique( const_reference data ) {
+		base_pointer	parent = &_header;
+		bool			left = true;
+
+		for (base_pointer tmp = _root(); tmp; tmp = left ? tmp->left : tmp->right) {
+			parent = tmp;
+			left = compare(data, value(tmp));
+		}
+
+		base_pointer	prev = parent;
+
+		if (left) {
+			if (parent == _header.left) {
+				return ft::make_pair(iterator(attach(node_create(data), parent, left)), true);
+			}
+			prev = decrement(parent);
+		}
+		if (!compare(value(prev), data)) {
+			return ft::make_pair(iterator(prev), false);
+		}
+		return ft::make_pair(iterator(attach(node_create(data), parent, left)), true);
+	}
+
 	iterator	insert( iterator hint, const_reference data ) {
 		(void)hint;
 		pair<iterator, bool>	p = insert(data);
@@ -185,11 +194,8 @@ public:
 	bool		empty( void ) const { return !_size; }
 
 	void		clear( void ) {
-		destroy(_root);
-		_root = NULL;
-		if (nil) {
-			nil->parent = NULL;
-		}
+		_clear(allocator_can_release<node_allocator_type>());
+		header_reset();
 		_size = 0;
 	}
 
@@ -198,36 +204,34 @@ public:
 			return ;
 		}
 
-		node_allocator_type	tmp_allocator = allocator;
 		value_compare		tmp_compare = compare;
-		node_type *			tmp_root = _root;
-		node_type *			tmp_nil = nil;
+		NodeBase			tmp_header = _header;
 		size_type			tmp_size = _size;
 
-		allocator = t.allocator;
+		swap_allocators(allocator, t.allocator);
 		compare = t.compare;
-		_root = t._root;
-		nil = t.nil;
+		_header = t._header;
 		_size = t._size;
 
-		t.allocator = tmp_allocator;
 		t.compare = tmp_compare;
-		t._root = tmp_root;
-		t.nil = tmp_nil;
+		t._header = tmp_header;
 		t._size = tmp_size;
+
+		header_relink();
+		t.header_relink();
 	}
 
 	/* Lookup */
-	iterator		find( const_reference data ) { return iterator(find(_root, data)); }
-	const_iterator	find( const_reference data ) const { return const_iterator(find(_root, data)); }
-	size_type	height( void ) const { return height(_root); }
+	iterator		find( const_reference data ) { return iterator(find(_root(), data)); }
+	const_iterator	find( const_reference data ) const { return const_iterator(find(_root(), data)); }
+	size_type	height( void ) const { return height(_root()); }
 
 	size_type	count( const_reference data ) const {
 		size_type	count = 0;
 
-		for (node_pointer tmp = _root; tmp && tmp != nil; ) {
-			if (!compare(data, tmp->data)) {
-				if (!compare(tmp->data, data)) {
+		for (base_pointer tmp = _root(); tmp; ) {
+			if (!compare(data, value(tmp))) {
+				if (!compare(value(tmp), data)) {
 					count++;
 				}
 				tmp = tmp->right;
@@ -241,132 +245,147 @@ public:
 	pair<iterator, iterator>	equal_range( const_reference key ) { return ft::make_pair(lower_bound(key), upper_bound(key)); }
 	pair<const_iterator, const_iterator>	equal_range( const_reference key ) const { return ft::make_pair(lower_bound(key), upper_bound(key)); }
 
-	iterator	lower_bound( const_reference key ) {
-		node_pointer	tmp = _root;
-		node_pointer	closest = NULL;
+	iterator		lower_bound( const_reference key ) { return iterator(_lower_bound(key)); }
+	const_iterator	lower_bound( const_reference key ) const { return const_iterator(_lower_bound(key)); }
+	iterator		upper_bound( const_reference key ) { return iterator(_upper_bound(key)); }
+	const_iterator	upper_bound( const_reference key ) const { return const_iterator(_upper_bound(key)); }
 
-		while (tmp && tmp != nil) {
-			if (!compare(tmp->data, key)) {
-				closest = tmp;
-				tmp = tmp->left;
-			} else {
-				tmp = tmp->right;
-			}
-		}
-		if (!closest) {
-			return end();
+	/* Traversal */
+	void	in_order( void (*function)(iterator) ) { in_order(_root(), function); }
+	void	pre_order( void (*function)(iterator) ) { pre_order(_root(), function); }
+	void	post_order( void (*function)(iterator) ) { post_order(_root(), function); }
+	void	breadth_order( void (*function)(iterator) ) {
+		const size_t	h = height();
+
+		for (size_t i = 1; i <= h; i++) {
+			breadth_order(_root(), i, function);
 		}
-		return iterator(closest);
 	}
 
-	const_iterator	lower_bound( const_reference key ) const {
-		return const_iterator(lower_bound(key));
-	}
+	/* Print */
+	std::string		to_str( void ) const { return to_str("", _root(), false); }
 
-	iterator	upper_bound( const_reference key ) {
-		node_pointer	tmp = _root;
-		node_pointer	closest = NULL;
+private:
+	/* Header */
+	base_pointer	_root( void ) const { return _header.parent; }
+	base_pointer	_end( void ) const { return const_cast<base_pointer>(&_header); }
+
+	static const_reference	value( base_pointer node ) { return static_cast<node_pointer>(node)->data; }
+
+	// The header of an empty tree: no root, end() on both sides
+	void	header_reset( void ) {
+		_header.color = RED;
+		_header.parent = NULL;
+		_header.left = &_header;
+		_header.right = &_header;
+	}
 
-		while (tmp && tmp != nil) {
-			if (compare(key, tmp->data)) {
-				closest = tmp;
-				tmp = tmp->left;
-			} else {
-				tmp = tmp->right;
-			}
-		}
-		if (!closest) {
-			return end();
+	// Points the root back to this header, once the header was copied in
+	void	header_relink( void ) {
+		if (_header.parent) {
+			_header.parent->parent = &_header;
+		} else {
+			header_reset();
 		}
-		return iterator(closest);
 	}
 
-	const_iterator	upper_bound( const_reference key ) const { return const_iterator(upper_bound(key)); }
-
-	/* Traversal */
-	void	in_order( void (*function)(iterator) ) { in_order(_root, function); }
-	void	pre_order( void (*function)(iterator) ) { pre_order(_root, function); }
-	void	post_order( void (*function)(iterator) ) { post_order(_root, function); }
-	void	breadth_order( void (*function)(iterator) ) {
-		const size_t	h = height();
+	void	set_root( base_pointer node ) { _header.parent = node; }
 
-		for (size_t i = 1; i <= h; i++) {
-			breadth_order(_root, i, function);
+	// Makes new_child take the place of node under node's parent
+	void	replace_child( base_pointer node, base_pointer new_child ) {
+		if (node == _root()) {
+			set_root(new_child);
+		} else if (is_left_child(node)) {
+			node->parent->left = new_child;
+		} else {
+			node->parent->right = new_child;
 		}
 	}
 
-	/* Print */
-	std::string		to_str( void ) const { return to_str("", _root, false); }
-
-private:
 	/* Nodes */
 	node_pointer	node_create( const_reference data ) {
 		node_pointer	node = allocator.allocate(1);
 
-		allocator.construct(node, data);
-		node->right = nil;
-		node->left = nil;
+		try {
+			allocator.construct(node, data);
+		} catch (...) {
+			allocator.deallocate(node, 1);
+			throw;
+		}
 		return node;
 	}
 
-	void	node_destroy( node_pointer node ) {
-		if (!node) {
-			return;
-		}
-		node->right = NULL;
-		node->left = NULL;
-		node->parent = NULL;
-		allocator.destroy(node);
-		allocator.deallocate(node, 1);
-	}
+	void	node_destroy( base_pointer node ) {
+		node_pointer	p = static_cast<node_pointer>(node);
 
-	void	nil_create( void ) {
-		nil = allocator.allocate(1);
-		allocator.construct(nil, value_type());
-		nil->color = BLACK;
-		nil->left = NULL;
-		nil->right = NULL;
-		nil->parent = NULL;
+		allocator.destroy(p);
+		allocator.deallocate(p, 1);
 	}
 
-	void	nil_destroy( void ) { node_destroy(nil); nil = NULL; }
-
-	void	destroy( node_pointer node ) {
-		if (node && node != nil) {
+	void	destroy( base_pointer node ) {
+		if (node) {
 			destroy(node->left);
 			destroy(node->right);
 			node_destroy(node);
 		}
 	}
 
+	// Destroys the data of a subtree, leaving the memory to the allocator
+	void	destroy_data( base_pointer node ) {
+		if (node) {
+			destroy_data(node->left);
+			destroy_data(node->right);
+			allocator.destroy(static_cast<node_pointer>(node));
+		}
+	}
+
+	void	_clear( false_type ) { destroy(_root()); }
+	void	_clear( true_type ) { destroy_data(_root()); allocator.release(); }
+
 	/* Modifier */
 	void	insert( node_pointer node ) {
-		for (node_pointer tmp = _root; tmp && tmp != nil; ) {
-			node->parent = tmp;
-			tmp = !compare(node->data, tmp->data) ? tmp->right : tmp->left;
+		base_pointer	parent = &_header;
+		bool			left = true;
+
+		for (base_pointer tmp = _root(); tmp; tmp = left ? tmp->left : tmp->right) {
+			parent = tmp;
+			left = compare(node->data, value(tmp));
 		}
+		attach(node, parent, left);
+	}
 
-		if (!node->parent) {
-			_root = node;
-		} else if (!compare(node->data, node->parent->data)) {
-			node->parent->right = node;
+	// Links a new leaf under parent (the header for the first node) and rebalances
+	node_pointer	attach( node_pointer node, base_pointer parent, bool left ) {
+		node->parent = parent;
+		if (parent == &_header) {
+			set_root(node);
+			_header.left = node;
+			_header.right = node;
+		} else if (!left) {
+			parent->right = node;
+			if (parent == _header.right) {
+				_header.right = node;
+			}
 		} else {
-			node->parent->left = node;
+			parent->left = node;
+			if (parent == _header.left) {
+				_header.left = node;
+			}
 		}
 		insert_fixup(node);
 		_size++;
-		nil->parent = rightmost_node(_root);
+		return node;
 	}
 
-	void	insert_fixup( node_pointer node ) {
-		while (node != _root) {
+	void	insert_fixup( base_pointer node ) {
+		while (node != _root()) {
 			if (is_black(node->parent)) {
 				break ;
 			}
 
-			node_pointer	parent = node->parent;
-			node_pointer	grandpa = parent->parent;
-			node_pointer	uncle = nil;
+			base_pointer	parent = node->parent;
+			base_pointer	grandpa = parent->parent;
+			base_pointer	uncle = NULL;
 
 			if (is_left_child(parent)) {
 				uncle = grandpa->right;
@@ -378,6 +397,7 @@ private:
 					rotate_right(grandpa);
 					parent->color = BLACK;
 					grandpa->color = RED;
+					break ;
 				} else {
 					// RED uncle so swap uncle & parent's and grandparent's colors
 					node = grandpa;
@@ -395,7 +415,7 @@ private:
 					rotate_left(grandpa);
 					parent->color = BLACK;
 					grandpa->color = RED;
-
+					break ;
 				} else {
 					// RED uncle so swap uncle & parent's and grandparent's colors
 					node = grandpa;
@@ -405,219 +425,169 @@ private:
 				}
 			}
 		}
-		_root->color = BLACK;
+		_root()->color = BLACK;
 	}
 
-	void	erase( node_pointer node ) {
-		if (node == nil) {
+	void	erase( base_pointer node ) {
+		if (node == &_header) {
 			return;
 		}
 
-		if (node->left != nil && node->right != nil) {
+		// The leftmost and rightmost nodes have at most one child: they are never swapped
+		if (_size == 1) {
+			_header.left = &_header;
+			_header.right = &_header;
+		} else if (node == _header.left) {
+			_header.left = increment(node);
+		} else if (node == _header.right) {
+			_header.right = decrement(node);
+		}
+
+		if (node->left && node->right) {
 			// 2 childs
-			node_pointer	successor = leftmost_node(node->right);
-			nodes_swap(node, successor);
+			nodes_swap(node, leftmost_node(node->right));
 		}
 
 		// 0 or 1 child
-		node_pointer	child = (node->left == nil) ? node->right : node->left;
-		if (!node->parent) {
-			_root = child;
-		} else if (is_left_child(node)) {
-			node->parent->left = child;
-		} else {
-			node->parent->right = child;
-		}
-		if (child != nil) {
-			child->parent = node->parent;
+		base_pointer	child = node->left ? node->left : node->right;
+		base_pointer	parent = node->parent;
+
+		replace_child(node, child);
+		if (child) {
+			child->parent = parent;
 		}
 		if (is_black(node)) {
-			erase_fixup(child, node->parent);
-		}
-		if (nil->parent == node) {
-			nil->parent = rightmost_node(_root);
-		}
-		if (node != nil) {
-			node_destroy(node);
+			erase_fixup(child, parent);
 		}
+		node_destroy(node);
 		_size--;
 	}
 
-	void	erase_fixup( node_pointer node, node_pointer parent ) {
-		while (node != nil && is_black(node) && node != _root) {
+	// node took the place of a black node and may be NULL, hence the explicit parent
+	void	erase_fixup( base_pointer node, base_pointer parent ) {
+		while (node != _root() && is_black(node)) {
 			if (node == parent->left) {
-				node_pointer	uncle = parent->right;
+				base_pointer	sibling = parent->right;
 
-				if (is_red(uncle)) {
-					// Case 1: node is left child, and right child (uncle) is red
+				if (is_red(sibling)) {
+					sibling->color = BLACK;
 					parent->color = RED;
-					uncle->color = BLACK;
 					rotate_left(parent);
+					sibling = parent->right;
+				}
+				if (is_black(sibling->left) && is_black(sibling->right)) {
+					sibling->color = RED;
+					node = parent;
+					parent = node->parent;
 				} else {
-					// Case 2: node is left child, and right child (uncle) is black
-					if (is_black(uncle->right)) {
-						uncle->color = RED;
-						uncle->left->color = BLACK;
-						rotate_right(uncle);
-						uncle = parent->right;
+					if (is_black(sibling->right)) {
+						sibling->left->color = BLACK;
+						sibling->color = RED;
+						rotate_right(sibling);
+						sibling = parent->right;
 					}
-					uncle->color = parent->color;
-					uncle->right->color = BLACK;
+					sibling->color = parent->color;
 					parent->color = BLACK;
+					sibling->right->color = BLACK;
 					rotate_left(parent);
-					node = _root;
+					node = _root();
 				}
 			} else {
-				node_pointer	uncle = parent->left;
+				base_pointer	sibling = parent->left;
 
-				// Case 3: node is right child, and left child (uncle) is red
-				if (is_red(uncle)) {
+				if (is_red(sibling)) {
+					sibling->color = BLACK;
 					parent->color = RED;
-					uncle->color = BLACK;
 					rotate_right(parent);
-					uncle = parent->left;
+					sibling = parent->left;
 				}
-
-				if (is_black(uncle->left) && is_black(uncle->right)) {
-					// Case 4: uncle has two childs
-					uncle->color = RED;
+				if (is_black(sibling->left) && is_black(sibling->right)) {
+					sibling->color = RED;
 					node = parent;
 					parent = node->parent;
 				} else {
-					// Case 5: uncle has one child or hasn't any
-					if (is_black(uncle->left)) {
-						uncle->right->color = BLACK;
-						uncle->color = RED;
-						rotate_left(uncle);
-						uncle = parent->left;
+					if (is_black(sibling->left)) {
+						sibling->right->color = BLACK;
+						sibling->color = RED;
+						rotate_left(sibling);
+						sibling = parent->left;
 					}
-					uncle->color = parent->color;
+					sibling->color = parent->color;
 					parent->color = BLACK;
-					uncle->left->color = BLACK;
+					sibling->left->color = BLACK;
 					rotate_right(parent);
-					node = _root;
+					node = _root();
 				}
 			}
 		}
-		if (node && node != nil) {
+		if (node) {
 			node->color = BLACK;
 		}
 	}
 
-	void	nodes_swap( node_pointer first, node_pointer second ) {
-		bool	is_left_child_first = first->parent && is_left_child(first);
-		bool	is_left_child_second = second->parent && is_left_child(second);
-		bool	direct_child = (second->parent == first);
-
-		node_pointer	tmp_parent = first->parent;
-		node_pointer	tmp_left = first->left;
-		node_pointer	tmp_right = first->right;
+	// Swaps the places (links and colors) of a node with two children and its successor
+	void	nodes_swap( base_pointer first, base_pointer second ) {
+		base_pointer	first_left = first->left;
+		base_pointer	first_right = first->right;
+		base_pointer	second_parent = second->parent;
+		base_pointer	second_right = second->right;
 		Color			tmp_color = first->color;
 
-		// Changing first node
 		first->color = second->color;
-		first->left = second->left;
-		first->right = second->right;
-		if (first->left != nil) {
-			first->left->parent = first;
-		}
-		if (first->right != nil) {
-			first->right->parent = first;
-		}
-		first->parent = (direct_child) ? second : second->parent;
-
-		if (direct_child) {
-			first->parent = second;
-		} else {
-			first->parent = second->parent;
-			if (!second->parent) {
-				_root = first;
-			} else if (is_left_child_second) {
-				second->parent->left = first;
-			} else {
-				second->parent->right = first;
-			}
-		}
-
-		// Changing second node
 		second->color = tmp_color;
-		second->parent = tmp_parent;
-		if (!tmp_parent) {
-			_root = second;
-		} else if (is_left_child_first) {
-			tmp_parent->left = second;
-		} else {
-			tmp_parent->right = second;
-		}
 
-		if (direct_child) {
-			if (is_left_child_second) {
-				second->right = tmp_right;
-				second->left = first;
-			} else {
-				second->right = first;
-				second->left = tmp_left;
-			}
+		// second takes the place of first
+		replace_child(first, second);
+		second->parent = first->parent;
+		second->left = first_left;
+		first_left->parent = second;
+		if (second_parent == first) {
+			second->right = first;
+			first->parent = second;
 		} else {
-			second->left = tmp_left;
-			second->right = tmp_right;
+			second->right = first_right;
+			first_right->parent = second;
+			second_parent->left = first;
+			first->parent = second_parent;
 		}
 
-		if (second->left != nil) {
-			second->left->parent = second;
-		}
-		if (second->right != nil) {
-			second->right->parent = second;
+		// first takes the place of second, which had no left child
+		first->left = NULL;
+		first->right = second_right;
+		if (second_right) {
+			second_right->parent = first;
 		}
 	}
 
-	void	rotate_right( node_pointer node ) {
-		node_pointer	left = node->left;
+	void	rotate_right( base_pointer node ) {
+		base_pointer	left = node->left;
 
 		node->left = left->right;
-		if (left != nil) {
-			left->parent = node->parent;
-			if (left->right != nil) {
-				left->right->parent = node;
-			}
-			left->right = node;
-		}
-
-		if (!node->parent) {
-			_root = left;
-		} else if (node == node->parent->right) {
-			node->parent->right = left;
-		} else {
-			node->parent->left = left;
+		if (left->right) {
+			left->right->parent = node;
 		}
+		left->parent = node->parent;
+		replace_child(node, left);
+		left->right = node;
 		node->parent = left;
 	}
 
-	void	rotate_left( node_pointer node ) {
-		node_pointer	right = node->right;
+	void	rotate_left( base_pointer node ) {
+		base_pointer	right = node->right;
 
 		node->right = right->left;
-		if (right != nil) {
-			right->parent = node->parent;
-			if (right->left != nil) {
-				right->left->parent = node;
-			}
-			right->left = node;
-		}
-
-		if (!node->parent) {
-			_root = right;
-		} else if (node == node->parent->left) {
-			node->parent->left = right;
-		} else {
-			node->parent->right = right;
+		if (right->left) {
+			right->left->parent = node;
 		}
+		right->parent = node->parent;
+		replace_child(node, right);
+		right->left = node;
 		node->parent = right;
 	}
 
 	/* Helpers */
-	size_type		height( node_pointer node ) const {
-		if (node == nil) {
+	size_type		height( base_pointer node ) const {
+		if (!node) {
 			return 0;
 		}
 		size_t	left_height = height(node->left);
@@ -626,25 +596,53 @@ private:
 	}
 
 	/* Access */
-	node_pointer	find( node_pointer node, const_reference data ) const {
-		if (!node || node == nil) {
-			return nil;
+	base_pointer	find( base_pointer node, const_reference data ) const {
+		if (!node) {
+			return _end();
 		}
 
-		if (!compare(data, node->data) && !compare(node->data, data)) {
+		if (!compare(data, value(node)) && !compare(value(node), data)) {
 			return node;
-		} else if (!compare(data, node->data)) {
+		} else if (!compare(data, value(node))) {
 			return find(node->right, data);
 		} else {
 			return find(node->left, data);
 		}
 	}
 
+	base_pointer	_lower_bound( const_reference key ) const {
+		base_pointer	closest = _end();
+
+		for (base_pointer tmp = _root(); tmp; ) {
+			if (!compare(value(tmp), key)) {
+				closest = tmp;
+				tmp = tmp->left;
+			} else {
+				tmp = tmp->right;
+			}
+		}
+		return closest;
+	}
+
+	base_pointer	_upper_bound( const_reference key ) const {
+		base_pointer	closest = _end();
+
+		for (base_pointer tmp = _root(); tmp; ) {
+			if (compare(key, value(tmp))) {
+				closest = tmp;
+				tmp = tmp->left;
+			} else {
+				tmp = tmp->right;
+			}
+		}
+		return closest;
+	}
+
 	/* Traversal */
-	void	breadth_order( node_pointer node, int lvl, void (*function)(iterator) ) const {
-		if (node != nil) {
+	void	breadth_order( base_pointer node, int lvl, void (*function)(iterator) ) const {
+		if (node) {
 			if (lvl == 1) {
-				function(node);
+				function(iterator(node));
 			} else if (lvl > 1) {
 				breadth_order(node->left, lvl - 1, function);
 				breadth_order(node->right, lvl - 1, function);
@@ -652,32 +650,32 @@ private:
 		}
 	}
 
-	void	pre_order( node_pointer node, void (*function)(iterator) ) const {
-		if (node != nil) {
-			function(node);
+	void	pre_order( base_pointer node, void (*function)(iterator) ) const {
+		if (node) {
+			function(iterator(node));
 			pre_order(node->left, function);
 			pre_order(node->right, function);
 		}
 	}
 
-	void	in_order( node_pointer node, void (*function)(iterator) ) const {
-		if (node != nil) {
+	void	in_order( base_pointer node, void (*function)(iterator) ) const {
+		if (node) {
 			in_order(node->left, function);
-			function(node);
+			function(iterator(node));
 			in_order(node->right, function);
 		}
 	}
 
-	void	post_order( node_pointer node, void (*function)(iterator) ) const {
-		if (node != nil) {
+	void	post_order( base_pointer node, void (*function)(iterator) ) const {
+		if (node) {
 			post_order(node->left, function);
 			post_order(node->right, function);
-			function(node);
+			function(iterator(node));
 		}
 	}
 
 	/* Print */
-	std::string		to_str( std::string const & prefix, const_node_pointer node, bool is_left ) const {
+	std::string		to_str( std::string const & prefix, base_pointer node, bool is_left ) const {
 		if (!node) {
 			return "";
 		}
@@ -687,7 +685,7 @@ private:
 		stream << prefix;
 		stream << (is_left ? "├──" : "└──");
 
-		stream << node->data << std::endl;
+		stream << value(node) << std::endl;
 
 		stream << to_str(prefix + (is_left ? "│   " : "    "), node->left, true);
 		stream << to_str(prefix + (is_left ? "│   " : "    "), node->right, false);
@@ -45,7 +45,7 @@ public:
 		for (std::size_t lvl = 0; lvl <= h; ++lvl) {
 			block = (spaces - (1 << lvl) * V_DATA_SIZE) / (1 << (lvl + 1));
 
-			visualize(tree.root().base(), lvl);
+			visualize(static_cast<Node<T> *>(tree.root().base()), lvl);
 
 			LOG(std::endl << line);
 			line.clear();
@@ -57,7 +57,7 @@ private:
 	template <typename T>
 	void	visualize( Node<T> *node, int lvl, bool left_child = false ) {
 		if (lvl == 0) {
-			if (is_leaf_node(node)) {
+			if (!node) {
 				String	data = (V_DATA_SIZE < 4 ? "N" : "NULL");
 
 				data = center(data, left_child);
@@ -98,8 +98,8 @@ private:
 				line.append(space_count, V_SPACE);
 			}
 		} else if (lvl > 0) {
-			if (is_leaf_node(node)) {
-				for (size_t i = 0; i < (1 << lvl); i++) {
+			if (!node) {
+				for (int i = 0; i < (1 << lvl); i++) {
 					COUT(String(block, V_SPACE));
 					COUT(String(V_DATA_SIZE, V_SPACE));
 					COUT(String(block, V_SPACE));
@@ -109,8 +109,8 @@ private:
 					line.append(block, V_SPACE);
 				}
 			} else {
-				visualize(node->left, lvl - 1, true);
-				visualize(node->right, lvl - 1, false);
+				visualize(static_cast<Node<T> *>(node->left), lvl - 1, true);
+				visualize(static_cast<Node<T> *>(node->right), lvl - 1, false);
 			}
 		}
 	}
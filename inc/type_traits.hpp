@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+
 namespace ft {
 
 // ************************************************************************** //
@@ -93,5 +95,117 @@ struct is_same : false_type { /* no-op */ };
 template<typename T>
 struct is_same<T, T> : true_type { /* no-op */ };
 
-}
 
+// ************************************************************************** //
+//                           remove_const template                            //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/types/remove_cv
+*/
+
+template <typename T>
+struct remove_const { typedef T type; };
+
+template <typename T>
+struct remove_const<const T> { typedef T type; };
+
+
+// ************************************************************************** //
+//                       is_floating_point template                           //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/types/is_floating_point
+*/
+
+template <typename T>
+struct is_floating_point : false_type { /* no-op */ };
+
+template <>
+struct is_floating_point<float> : true_type { /* no-op */ };
+
+template <>
+struct is_floating_point<double> : true_type { /* no-op */ };
+
+template <>
+struct is_floating_point<long double> : true_type { /* no-op */ };
+
+
+// ************************************************************************** //
+//                          is_arithmetic template                            //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/types/is_arithmetic
+*/
+
+template <typename T>
+struct is_arithmetic
+	: integral_constant<bool, is_integral<T>::value || is_floating_point<T>::value> { /* no-op */ };
+
+
+// ************************************************************************** //
+//                            is_pointer template                             //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/types/is_pointer
+*/
+
+template <typename T>
+struct is_pointer : false_type { /* no-op */ };
+
+template <typename T>
+struct is_pointer<T*> : true_type { /* no-op */ };
+
+
+// ************************************************************************** //
+//                            is_scalar template                              //
+// ************************************************************************** //
+
+/*
+**	https://en.cppreference.com/w/cpp/types/is_scalar
+**
+**	Enumerations and pointers to members aren't detected.
+*/
+
+template <typename T>
+struct is_scalar
+	: integral_constant<bool, is_arithmetic<T>::value || is_pointer<T>::value> { /* no-op */ };
+
+
+// ************************************************************************** //
+//                    is_trivially_relocatable template                       //
+// ************************************************************************** //
+
+/*
+**	A type is trivially relocatable when moving an object to a new address and
+**	forgetting the old one is the same as a plain memcpy of its bytes. Containers
+**	use it to grow their storage without running constructors and destructors.
+**
+**	Only arithmetic and pointer types are detected. Other types opt in by
+**	specializing the trait.
+*/
+
+template <typename T>
+struct is_trivially_relocatable : integral_constant<bool, is_scalar<T>::value> { /* no-op */ };
+
+
+// ************************************************************************** //
+//                      is_swap_relocatable template                          //
+// ************************************************************************** //
+
+/*
+**	Types that are cheap to default construct and have a member swap that only
+**	exchanges handles. Without move semantics (C++98) they are relocated by
+**	swapping into a default constructed object instead of being deep copied.
+*/
+
+template <typename T>
+struct is_swap_relocatable : false_type { /* no-op */ };
+
+template <typename Char, typename Traits, typename Alloc>
+struct is_swap_relocatable< std::basic_string<Char, Traits, Alloc> > : true_type { /* no-op */ };
+
+}
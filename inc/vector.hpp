@@ -8,6 +8,8 @@
 #include "iterator.hpp"
 #include "type_traits.hpp"
 #include "algorithm.hpp"
+#include "memory.hpp"
+#include "growth.hpp"
 
 namespace ft {
 
@@ -15,13 +17,18 @@ namespace ft {
 //                               vector template                           	  //
 // ************************************************************************** //
 
-template< typename T, typename Allocator = std::allocator<T> >
+template<
+	typename T,
+	typename Allocator = std::allocator<T>,
+	typename GrowthPolicy = ft::factor_growth<2, 1>
+>
 class vector {
 
 public:
 	/* Member types */
 	typedef T													value_type;
 	typedef Allocator											allocator_type;
+	typedef GrowthPolicy										growth_policy;
 	typedef typename allocator_type::reference					reference;
 	typedef typename allocator_type::const_reference			const_reference;
 	typedef typename allocator_type::pointer					pointer;
@@ -50,7 +57,7 @@ public:
 	explicit vector ( size_type n,
 					  const value_type & val = value_type(),
 					  const allocator_type & alloc = allocator_type() )
-		: c(NULL), _size(n), _capacity(n), _allocator(alloc) {
+		: c(NULL), _size(0), _capacity(0), _allocator(alloc) {
 			if (n == 0) {
 				return ;
 			}
@@ -62,10 +69,15 @@ public:
 #endif
 			}
 
-			c = _allocate(n);
-			for (size_type i = 0; i < n; i++) {
-				_construct(c + i, val);
+			_capacity = _padded(n);
+			c = _allocate(_capacity);
+			try {
+				ft::uninitialized_fill_n(c, n, val, _allocator);
+			} catch (...) {
+				_deallocate();
+				throw;
 			}
+			_size = n;
 		} // fill
 
 	template <typename InputIterator>
@@ -73,41 +85,19 @@ public:
 			 InputIterator last,
 			 const allocator_type & alloc = allocator_type() )
 		: c(NULL), _size(0), _capacity(0), _allocator(alloc) {
-		/*
-		** Attention: the operations available on these iterators are restricted to InputIterators
-		** https://cplusplus.com/reference/iterator/InputIterator/
-		*/
-		for (InputIterator it = first; it != last; it++) {
-			_size++;
-		}
-
-		size_type	capacity = _next_capacity(_capacity, _size);
-
-		c = _allocate(capacity);
-		_capacity = capacity;
-
-		size_type	i = 0;
-		for (InputIterator it = first; it != last; it++) {
-			_construct(c + i, *it);
-			i++;
-		}
+		_range_initialize(first, last, ft::_iterator_category(first));
 	} // range
 
-	vector ( const vector & v ) : c(NULL), _size(0), _capacity(0), _allocator(v._allocator) { *this = v; } // copy
+	vector ( const vector & v ) : c(NULL), _size(0), _capacity(0), _allocator(v._allocator) {
+		_range_initialize(v.begin(), v.end(), ft::random_access_iterator_tag());
+	} // copy
 
 	/* Assignment operator */
 	vector &	operator = ( const vector & v ) {
-		if (this != &v) {
-			if (c) {
-				clear();
-				_deallocate();
-			}
-			_allocator = v._allocator;
-			c = _allocate(v._capacity);
-			_capacity = v._capacity;
-			_copy(v);
-			_size = v._size;
+		if (this == &v) {
+			return *this;
 		}
+		_range_assign(v.c, v.c + v._size, ft::random_access_iterator_tag());
 		return *this;
 	}
 
@@ -129,17 +119,25 @@ public:
 	size_type	max_size( void ) const { return _allocator.max_size(); }
 
 	void	resize( size_type n, value_type val = value_type() ) {
-		if (n == _size) {
-			return ;
+		if (n > _size) {
+			if (n > _capacity) {
+				_reallocate(_grow(n - _size));
+			}
+			ft::uninitialized_fill_n(c + _size, n - _size, val, _allocator);
+			_size = n;
+		} else {
+			erase(begin() + n, end());
 		}
+	}
 
+	// Like resize, but new scalar elements are left uninitialized (to be overwritten right away)
+	void	resize_default_init( size_type n ) {
 		if (n > _size) {
-			if (_size * 2 < n) {
-				reserve(n);
-			}
-			for (size_type i = n - _size; i > 0; i--) {
-				push_back(val);
+			if (n > _capacity) {
+				_reallocate(_grow(n - _size));
 			}
+			ft::uninitialized_default_n(c + _size, n - _size, _allocator);
+			_size = n;
 		} else {
 			erase(begin() + n, end());
 		}
@@ -157,19 +155,26 @@ public:
 #endif
 		}
 		if (n > _capacity) {
-			pointer		tmp = _allocate(n);
-			for (size_type i = 0; i < _size; i++) {
-				_construct(tmp + i, c[i]);
-			}
-			size_type	tmp_size = _size;
-			clear();
-			_deallocate();
-			c = tmp;
-			_size = tmp_size;
-			_capacity = n;
+			_reallocate(n);
 		}
 	}
 
+	// Sets the capacity to exactly max(n, size()), shrinking the storage if needed
+	void	reserve_exact( size_type n ) {
+		if (n > max_size()){
+			throw std::length_error("vector::reserve_exact");
+		}
+		n = _padded(std::max(n, _size));
+		if (n != _capacity) {
+			_reallocate(n);
+		}
+	}
+
+	void	shrink_to_fit( void ) { reserve_exact(_size); }
+
+	// Destroys every element and gives the storage back to the allocator
+	void	release( void ) { clear(); _reallocate(0); }
+
 	/* Element access */
 	reference			operator [] ( size_type n ) { return c[n]; }
 	const_reference		operator [] ( size_type n ) const { return c[n]; }
@@ -182,40 +187,52 @@ public:
 	value_type *		data( void ) { return c; }
 	const value_type *	data( void ) const { return c; }
 
+	/*
+	**	data() for allocators with an allocator_alignment, telling the compiler
+	**	that the buffer starts (and, capacity being padded, ends) on that
+	**	boundary so vectorized loops need no peeling.
+	*/
+	value_type *		aligned_data( void ) { return _assume_aligned(c); }
+	const value_type *	aligned_data( void ) const { return _assume_aligned(c); }
+
 	/* Modifiers */
 	template <typename InputIterator>
 	void	assign( typename ft::enable_if<!ft::is_integral<InputIterator>::value,
 					InputIterator>::type first,
 					InputIterator last ) {
-		size_type	n = 0;
-		for (InputIterator it = first; it != last; it++) {
-			n++;
-		}
-
-		if (n >= _capacity) {
-			vector tmp(first, last, _allocator);
-			swap(tmp);
-		} else {
-			clear();
-			insert(begin(), first, last);
-		}
+		_range_assign(first, last, ft::_iterator_category(first));
 	} // range
 
 	void	assign( size_type n, const value_type & val ) {
-		if (n >= _capacity) {
+		if (n > _capacity) {
 			vector tmp(n, val, _allocator);
 			swap(tmp);
-		} else {
-			clear();
-			insert(begin(), n, val);
+			return ;
 		}
+		// assign first, construct next, destroy last: val may be one of the elements
+		size_type	live = std::min(n, _size);
+
+		ft::fill_n(c, live, val);
+		ft::uninitialized_fill_n(c + live, n - live, val, _allocator);
+		ft::destroy(c + live, c + _size, _allocator);
+		_size = n;
 	} // fill
 
 	void	push_back( const value_type & val ) {
-		if (_capacity < _size + 1) {
-			reserve(_next_capacity(_size, _size + 1));
+		if (_capacity == _size && _reallocatable::value) {
+			const value_type	copy(val); // val may be one of our elements
+
+			_reallocate(_grow(1));
+			_construct(c + _size, copy);
+		} else if (_capacity == _size) {
+			const value_type	copy(val); // val may be one of our elements
+			size_type			capacity = _grow(1);
+
+			_move_to(_allocate(capacity), capacity, _size, 0);
+			_construct(c + _size, copy);
+		} else {
+			_construct(c + _size, val);
 		}
-		_construct(c + _size, val);
 		_size++;
 	};
 
@@ -230,30 +247,22 @@ public:
 	}
 
 	// fill
-    void	insert( iterator position, size_type n, const value_type & val ) {
+	void	insert( iterator position, size_type n, const value_type & val ) {
 		if (n == 0) {
 			return;
 		}
-		size_type	j = position - begin();
-
-		if (_capacity < _size + n) {
-			reserve(std::max(2 * _size, _size + n));
-		}
-		// Move previous values
-		if (_size) {
-			for (size_type i = _size - 1; i >= j; i--) {
-				_construct(c + i + n, c[i]);
-				_destroy(c + i);
-				if (i == 0) { // unsigned can't go below 0
-					break;
-				}
-			}
-		}
-		// Insert new values
-		while (n--) {
-			_construct(c + j + n, val);
-			_size++;
+		size_type			j = position - begin();
+		const value_type	copy(val); // val may live in the storage we are about to move
+		size_type			live = std::min(_open_gap(j, n), j + n);
+
+		try {
+			ft::fill(c + j, c + live, copy);
+			ft::uninitialized_fill_n(c + live, j + n - live, copy, _allocator);
+		} catch (...) {
+			_abandon_gap(j, n, live);
+			throw;
 		}
+		_size += n;
 	}
 
 	// range
@@ -261,59 +270,17 @@ public:
 	void	insert( iterator position,
 					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type first,
 					InputIterator last ) {
-		/*
-		** Attention: the operations available on these iterators are restricted to InputIterators
-		** https://cplusplus.com/reference/iterator/InputIterator/
-		*/
-		size_type	j = position - begin(); // has to be before because can grow, invalidating iterators
-
-		size_type	n = 0;
-		for (InputIterator it = first; it != last; it++) {
-			n++;
-		}
-		if (n == 0) {
-			return;
-		}
-
-		if (_capacity < _size + n) {
-			reserve(std::max(2 * _size, _size + n));
-		}
-
-		// Move previous values
-		if (_size) {
-			for (size_type i = _size - 1; i >= j; i--) {
-				_construct(c + i + n, c[i]);
-				_destroy(c + i);
-				if (i == 0) { // unsigned can't go below 0
-					break;
-				}
-			}
-		}
-		// Insert new values
-		for (InputIterator it = first; it != last; it++) {
-			_construct(c + j, *it);
-			j++;
-		}
-		_size += n;
+		_range_insert(position - begin(), first, last, ft::_iterator_category(first));
 	}
 
 	iterator	erase( iterator position ) { return erase(position, position + 1); } // single element
 
 	iterator	erase( iterator first, iterator last ) {
-		size_type	j = last - begin();
-
-		for (size_type i = first - begin(); i != j; i++) {
-			_destroy(c + i);
-		}
-
 		size_type	n = last - first;
 
-		_size = _size - n;
-		for (size_type i = first - begin(); i != _size; i++) {
-			_construct(c + i, c[i + n]);
-			_destroy(c + i + n);
+		if (n) {
+			_close_gap(first - begin(), n);
 		}
-
 		return first;
 	} // range
 
@@ -345,24 +312,198 @@ public:
 
 private:
 
-	void	_copy( vector const & v ) {
-		if (v._size > _capacity || !c) {
-			return ;
+	// Moves the elements to a new block of exactly n elements (none if n is 0)
+	// Elements can be moved with allocator_type::reallocate
+	typedef integral_constant<bool,
+		allocator_can_reallocate<allocator_type>::value && is_trivially_relocatable<value_type>::value>	_reallocatable;
+
+	void	_reallocate( size_type n ) { _reallocate(_padded(n), _reallocatable()); }
+
+	void	_reallocate( size_type n, true_type ) {
+		c = _allocator.reallocate(c, _capacity, n);
+		_capacity = n;
+	} // by the allocator
+
+	void	_reallocate( size_type n, false_type ) { _move_to(n ? _allocate(n) : NULL, n, _size, 0); } // new block
+
+	/*
+	**	Relocates the elements to tmp, a new block of capacity elements, leaving
+	**	n free slots at index j, and makes it the storage. If an element throws
+	**	on the way, tmp is freed and the vector keeps its elements where they were.
+	*/
+	void	_move_to( pointer tmp, size_type capacity, size_type j, size_type n ) {
+		try {
+			ft::uninitialized_relocate_gap(c, c + _size, tmp, j, n, _allocator);
+		} catch (...) {
+			if (tmp) {
+				_allocator.deallocate(tmp, capacity);
+			}
+			throw;
 		}
-		for (size_type i = 0; i < v._size; i++) {
-			_construct(c + i, v[i]);
+		_deallocate();
+		c = tmp;
+		_capacity = capacity;
+	}
+
+	// capacity needed to hold n more elements
+	size_type	_grow( size_type n ) const {
+		return _padded(growth_policy::grow(_size, _size + n, max_size(), sizeof(value_type)));
+	}
+
+	// n rounded up so the buffer is a whole number of allocator_alignment blocks
+	size_type	_padded( size_type n ) const {
+		const size_type	alignment = allocator_alignment<allocator_type>::value;
+		const size_type	step = alignment % sizeof(value_type) ? alignment : alignment / sizeof(value_type);
+
+		if (alignment == 0 || n > max_size() - step) {
+			return n;
 		}
+		return (n + step - 1) / step * step;
+	}
+
+	template <typename P>
+	static P *	_assume_aligned( P * p ) {
+		const size_t	alignment = allocator_alignment<allocator_type>::value;
+		typedef char	_aligned_allocator_check[alignment ? 1 : -1]; // only for aligned allocators
+
+		(void)sizeof(_aligned_allocator_check);
+#if defined(__GNUC__)
+		return static_cast<P *>(__builtin_assume_aligned(p, alignment));
+#else
+		return p;
+#endif
 	}
 
-	size_type	_next_capacity( size_type start, size_type end ) {
-		size_type	capacity = start ? start : 1;
+	/* Ranges */
+	/*
+	**	Constructor bodies: a throw leaves no vector to destroy, so they free
+	**	what they built themselves.
+	*/
+	template <typename InputIterator>
+	void	_range_initialize( InputIterator first, InputIterator last, ft::input_iterator_tag ) {
+		try {
+			for (; first != last; ++first) {
+				push_back(*first);
+			}
+		} catch (...) {
+			clear();
+			_deallocate();
+			throw;
+		}
+	} // single pass
+
+	template <typename ForwardIterator>
+	void	_range_initialize( ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag ) {
+		size_type	n = ft::distance(first, last);
+
+		if (n == 0) {
+			return ;
+		}
+		_capacity = _padded(n);
+		c = _allocate(_capacity);
+		try {
+			ft::uninitialized_copy(first, last, c, _allocator);
+		} catch (...) {
+			_deallocate();
+			throw;
+		}
+		_size = n;
+	} // sized
+
+	template <typename InputIterator>
+	void	_range_assign( InputIterator first, InputIterator last, ft::input_iterator_tag ) {
+		iterator	it = begin();
+
+		for (; it != end() && first != last; ++it, ++first) {
+			*it = *first;
+		}
+		erase(it, end());
+		for (; first != last; ++first) {
+			push_back(*first);
+		}
+	} // single pass
+
+	template <typename ForwardIterator>
+	void	_range_assign( ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag ) {
+		size_type	n = ft::distance(first, last);
+
+		if (n > _capacity) {
+			vector tmp(first, last, _allocator);
+			swap(tmp);
+			return ;
+		}
+		// reuse the storage: assign the live elements, construct or destroy the difference
+		size_type		live = std::min(n, _size);
+		ForwardIterator	mid = first;
+
+		ft::advance(mid, live);
+		ft::copy(first, mid, c);
+		ft::uninitialized_copy(mid, last, c + live, _allocator);
+		ft::destroy(c + live, c + _size, _allocator);
+		_size = n;
+	} // sized
+
+	template <typename InputIterator>
+	void	_range_insert( size_type j, InputIterator first, InputIterator last, ft::input_iterator_tag ) {
+		vector	tmp(first, last, _allocator); // can only be read once
+
+		_range_insert(j, tmp.begin(), tmp.end(), ft::random_access_iterator_tag());
+	} // single pass
 
-		while (capacity < end) {
-			capacity *= 2;
+	template <typename ForwardIterator>
+	void	_range_insert( size_type j, ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag ) {
+		size_type	n = ft::distance(first, last);
+
+		if (n == 0) {
+			return;
+		}
+
+		size_type		live = std::min(_open_gap(j, n), j + n);
+		ForwardIterator	mid = first;
+
+		ft::advance(mid, live - j);
+		try {
+			ft::copy(first, mid, c + j);
+			ft::uninitialized_copy(mid, last, c + live, _allocator);
+		} catch (...) {
+			_abandon_gap(j, n, live);
+			throw;
+		}
+		_size += n;
+	} // sized
+
+	/* Shifting */
+
+	/*
+	**	Makes room for n elements at index j, growing the storage if needed.
+	**	Returns the index where uninitialized memory starts: gap slots before it
+	**	still hold live objects and must be assigned, the others constructed.
+	*/
+	size_type	_open_gap( size_type j, size_type n ) {
+		if (_capacity < _size + n && _reallocatable::value) {
+			_reallocate(_grow(n));
+		} else if (_capacity < _size + n) {
+			size_type	capacity = _grow(n);
+
+			_move_to(_allocate(capacity), capacity, j, n);
+			return j;
 		}
-		return capacity;
+		return ft::open_gap(c + j, c + _size, n, _allocator) - c;
 	}
 
+	/*
+	**	Called when filling the gap opened by _open_gap(j, n) throws: [live, j + n)
+	**	holds nothing, so the elements shifted past it are destroyed and the
+	**	vector ends at live.
+	*/
+	void	_abandon_gap( size_type j, size_type n, size_type live ) {
+		ft::destroy(c + j + n, c + _size + n, _allocator);
+		_size = live;
+	}
+
+	// Removes the n elements at index j, pulling the tail over them.
+	void	_close_gap( size_type j, size_type n ) { ft::close_gap(c + j, c + _size, n, _allocator); _size -= n; }
+
 	std::string	range_error( size_type n ) {
 #if defined(DARWIN)
 		std::string		error("vector");
@@ -381,42 +522,66 @@ private:
 	/* Allocator wrappers */
 	pointer			_allocate( size_type capacity ) { return _allocator.allocate(capacity); }
 	void			_deallocate( void ) { if (c) _allocator.deallocate(c, _capacity); }
-	void			_destroy( pointer p ) { if (p) _allocator.destroy(p); }
-	void			_construct( pointer p, value_type val ) { if (p) _allocator.construct(p, val); }
+	void			_construct( pointer p, const value_type & val ) { _allocator.construct(p, val); }
 
 };
 
 /* Non-member functions */
 
 // relational operators
-template <typename T, typename Alloc>
-inline bool	operator == ( const vector<T, Alloc> & lhs, const vector<T, Alloc> & rhs ) {
+template <typename T, typename Alloc, typename Growth>
+inline bool	operator == ( const vector<T, Alloc, Growth> & lhs, const vector<T, Alloc, Growth> & rhs ) {
 	if (lhs.size() == rhs.size()) {
 		return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
 	}
 	return false;
 }
 
-template <typename T, typename Alloc>
-bool	operator != ( const vector<T, Alloc> & lhs, const vector<T, Alloc> & rhs ) { return !(lhs == rhs); }
+template <typename T, typename Alloc, typename Growth>
+bool	operator != ( const vector<T, Alloc, Growth> & lhs, const vector<T, Alloc, Growth> & rhs ) { return !(lhs == rhs); }
 
-template <typename T, typename Alloc>
-bool	operator < ( const vector<T, Alloc> & lhs, const vector<T, Alloc> & rhs ) {
+template <typename T, typename Alloc, typename Growth>
+bool	operator < ( const vector<T, Alloc, Growth> & lhs, const vector<T, Alloc, Growth> & rhs ) {
 	return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
-template <typename T, typename Alloc>
-bool	operator <= ( const vector<T, Alloc> & lhs, const vector<T, Alloc> & rhs ) { return !(rhs < lhs); }
+template <typename T, typename Alloc, typename Growth>
+bool	operator <= ( const vector<T, Alloc, Growth> & lhs, const vector<T, Alloc, Growth> & rhs ) { return !(rhs < lhs); }
 
-template <typename T, typename Alloc>
-bool	operator > ( const vector<T, Alloc> & lhs, const vector<T, Alloc> & rhs ) { return rhs < lhs; }
+template <typename T, typename Alloc, typename Growth>
+bool	operator > ( const vector<T, Alloc, Growth> & lhs, const vector<T, Alloc, Growth> & rhs ) { return rhs < lhs; }
 
-template <typename T, typename Alloc>
-bool	operator >= ( const vector<T, Alloc> & lhs, const vector<T, Alloc> & rhs ) { return !(lhs < rhs); }
+template <typename T, typename Alloc, typename Growth>
+bool	operator >= ( const vector<T, Alloc, Growth> & lhs, const vector<T, Alloc, Growth> & rhs ) { return !(lhs < rhs); }
 
 // swap
-template <typename T, typename Alloc>
-void	swap( vector<T, Alloc> & lhs, vector<T, Alloc> & rhs ) { lhs.swap(rhs); }
+template <typename T, typename Alloc, typename Growth>
+void	swap( vector<T, Alloc, Growth> & lhs, vector<T, Alloc, Growth> & rhs ) { lhs.swap(rhs); }
+
+/*
+**	https://en.cppreference.com/w/cpp/container/vector/erase2
+**
+**	Compacts the kept elements with ft::remove_if, then erases the tail once.
+**	Returns the number of elements erased.
+*/
+template <typename T, typename Alloc, typename Growth, typename Predicate>
+typename vector<T, Alloc, Growth>::size_type	erase_if( vector<T, Alloc, Growth> & v, Predicate pred ) {
+	typename vector<T, Alloc, Growth>::iterator		last = ft::remove_if(v.begin(), v.end(), pred);
+	typename vector<T, Alloc, Growth>::size_type	n = v.end() - last;
+
+	v.erase(last, v.end());
+	return n;
+}
+
+template <typename T, typename Alloc, typename Growth, typename U>
+typename vector<T, Alloc, Growth>::size_type	erase( vector<T, Alloc, Growth> & v, const U & val ) {
+	return ft::erase_if(v, _equal_to_value<U>(val));
+}
+
+// relocation
+template <typename T, typename Alloc, typename Growth>
+struct is_swap_relocatable< vector<T, Alloc, Growth> > : true_type { /* no-op */ };
 
 }
 
+#include "bit_vector.hpp" // the vector<bool> specialization
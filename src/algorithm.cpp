@@ -0,0 +1,467 @@
+#include "tests/algorithm_tests.hpp"
+
+void	algorithm_test_equal_bytes( void ) {
+	CASE("Equal - bytes");
+
+	ByteVector	a(1000, 0x80);
+	ByteVector	b(a);
+
+	LOG(SPEC(ft::equal(a.begin(), a.end(), b.begin())) << "Copies are equal");
+
+	b[999] = 0x7f;
+	LOG(SPEC(!ft::equal(a.begin(), a.end(), b.begin())) << "Last byte differs");
+	LOG(SPEC(ft::equal(a.begin(), a.end() - 1, b.begin())) << "Equal up to the last byte");
+	LOG(SPEC(ft::equal(a.begin(), a.begin(), b.end())) << "Empty ranges are equal");
+	LOG("");
+}
+
+void	algorithm_test_equal_pointers( void ) {
+	CASE("Equal - pointers");
+
+	const int	numbers[5] = {-2, -1, 0, 1, 2};
+	int			copy[5] = {-2, -1, 0, 1, 2};
+	double		zeros[2] = {0.0, -0.0};
+	double		other[2] = {-0.0, 0.0};
+
+	LOG(SPEC(ft::equal(numbers, numbers + 5, copy)) << "int arrays are equal");
+	copy[2] = 3;
+	LOG(SPEC(!ft::equal(numbers, numbers + 5, copy)) << "int arrays differ");
+	LOG(SPEC(ft::equal(zeros, zeros + 2, other)) << "0.0 == -0.0");
+	LOG("");
+}
+
+void	algorithm_test_lexicographical_compare_bytes( void ) {
+	CASE("Lexicographical compare - bytes");
+
+	ByteVector	a(1000, 0x10);
+	ByteVector	b(a);
+
+	LOG(SPEC(!ft::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end())) << "!(a < a)");
+
+	b[500] = 0xf0;
+	LOG(SPEC(ft::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end())) << "0x10 < 0xf0");
+	LOG(SPEC(!ft::lexicographical_compare(b.begin(), b.end(), a.begin(), a.end())) << "!(0xf0 < 0x10)");
+
+	b[500] = 0x10;
+	b.pop_back();
+	LOG(SPEC(ft::lexicographical_compare(b.begin(), b.end(), a.begin(), a.end())) << "Prefix is smaller");
+	LOG(SPEC(!ft::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end())) << "!(a < prefix)");
+	LOG(SPEC(a > b) << "a > b");
+	LOG("");
+}
+
+void	algorithm_test_lexicographical_compare_signed( void ) {
+	CASE("Lexicographical compare - signed");
+
+	IntVector	a(2000, 1);
+	IntVector	b(a);
+
+	b[1500] = -1;
+	LOG(SPEC(ft::lexicographical_compare(b.begin(), b.end(), a.begin(), a.end())) << "-1 < 1");
+	LOG(SPEC(b < a) << "b < a");
+
+	b[1500] = 256; // bytes 00 01 00 00 against 01 00 00 00
+	LOG(SPEC(ft::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end())) << "1 < 256");
+
+	const char	lower[3] = {'a', 'b', 'c'};
+	const char	high[3] = {'a', 'b', static_cast<char>(0xe9)};
+
+	LOG(SPEC(ft::lexicographical_compare(high, high + 3, lower, lower + 3)
+		== (static_cast<char>(0xe9) < 'c')) << "char follows its own signedness");
+	LOG("");
+}
+
+template <typename Vector>
+void	print_range( const Vector & v ) {
+	COUT("[");
+	for (typename Vector::const_iterator it = v.begin(); it != v.end(); ++it) {
+		COUT((it == v.begin() ? "" : ", ") << *it);
+	}
+	LOG("]");
+}
+
+void	algorithm_test_copy( void ) {
+	CASE("Copy - overlapping");
+
+	const int	numbers[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+	IntVector	v(numbers, numbers + 8);
+
+	IntVector::iterator	end = ft::copy(v.begin() + 2, v.end(), v.begin());
+	print_range(v);
+	LOG(SPEC(end == v.begin() + 6) << "Returns the end of the copy");
+
+	v.assign(numbers, numbers + 8);
+	IntVector::iterator	begin = ft::copy_backward(v.begin(), v.begin() + 6, v.end());
+	print_range(v);
+	LOG(SPEC(begin == v.begin() + 2) << "Returns the beginning of the copy");
+	LOG("");
+}
+
+void	algorithm_test_copy_reverse( void ) {
+	CASE("Copy - reverse iterators");
+
+	const int	numbers[5] = {1, 2, 3, 4, 5};
+	IntVector	v(numbers, numbers + 5);
+	IntVector	reversed(5);
+	IntVector	same(5);
+
+	ft::copy(v.rbegin(), v.rend(), reversed.begin());
+	ft::copy(v.rbegin(), v.rend(), same.rbegin());
+	print_range(reversed);
+	print_range(same);
+
+	ft::vector<Algorithm_t>	words(3, "foo");
+	ft::vector<Algorithm_t>	copies(4, "bar");
+
+	ft::copy(words.rbegin(), words.rend(), copies.rbegin());
+	print_range(copies);
+	LOG("");
+}
+
+void	algorithm_test_fill( void ) {
+	CASE("Fill");
+
+	IntVector	v(6, 0);
+
+	ft::fill(v.begin() + 1, v.end() - 1, -1);
+	print_range(v);
+	ft::fill(v.rbegin(), v.rbegin() + 2, 258);
+	print_range(v);
+	LOG(SPEC(ft::fill_n(v.begin(), 3, 7) == v.begin() + 3) << "fill_n returns the end of the range");
+	print_range(v);
+
+	ByteVector	bytes(4);
+
+	ft::fill_n(bytes.begin(), 4, 'x');
+	print_range(bytes);
+	LOG("");
+}
+
+struct IsNegative {
+	bool	operator () ( int x ) const { return x < 0; }
+};
+
+struct SameTens {
+	bool	operator () ( int a, int b ) const { return a / 10 == b / 10; }
+};
+
+void	algorithm_test_remove_unique( void ) {
+	CASE("Remove / remove_if / unique");
+
+	const int	numbers[10] = {3, -1, 3, 3, 7, -4, 7, 3, 12, 15};
+	IntVector	v(numbers, numbers + 10);
+
+	IntVector::iterator	end = ft::remove(v.begin(), v.end(), 3);
+	LOG("kept: " << (end - v.begin()));
+	v.erase(end, v.end());
+	print_range(v);
+
+	v.assign(numbers, numbers + 10);
+	v.erase(ft::remove_if(v.begin(), v.end(), IsNegative()), v.end());
+	print_range(v);
+
+	v.erase(ft::unique(v.begin(), v.end()), v.end());
+	print_range(v);
+
+	v.assign(numbers, numbers + 10);
+	v.erase(ft::unique(v.begin(), v.end(), SameTens()), v.end());
+	print_range(v);
+
+	Algorithm_t				words[6] = {"fig", "fig", "pear", "fig", "kiwi", "kiwi"};
+	ft::vector<Algorithm_t>	w(words, words + 6);
+
+	w.erase(ft::unique(w.begin(), w.end()), w.end());
+	print_range(w);
+	w.erase(ft::remove(w.begin(), w.end(), "fig"), w.end());
+	print_range(w);
+
+	IntVector	empty;
+
+	LOG(SPEC(ft::remove(empty.begin(), empty.end(), 0) == empty.end()) << "Empty range");
+	LOG(SPEC(ft::unique(empty.begin(), empty.end()) == empty.end()) << "Empty range");
+	LOG("");
+}
+
+template <typename Vector>
+bool	is_sorted_range( const Vector & v ) {
+	for (size_t i = 1; i < v.size(); i++) {
+		if (v[i] < v[i - 1]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Same sequence on every platform, unlike rand()
+int	next_random( unsigned int & seed ) {
+	seed = seed * 1103515245 + 12345;
+	return static_cast<int>((seed >> 8) % 2001) - 1000;
+}
+
+void	algorithm_test_sort( void ) {
+	CASE("Sort");
+
+	const int	numbers[10] = {5, -3, 9, 0, 9, -8, 2, 7, -3, 1};
+	IntVector	small(numbers, numbers + 10);
+
+	ft::sort(small.begin(), small.end());
+	print_range(small);
+
+	unsigned int	seed = 42;
+	IntVector		big;
+
+	for (int i = 0; i < 5000; i++) {
+		big.push_back(next_random(seed));
+	}
+	ft::sort(big.begin(), big.end());
+	LOG(SPEC(is_sorted_range(big)) << "5000 random ints are sorted");
+	LOG("min: " << big.front() << ", median: " << big[2500] << ", max: " << big.back());
+
+	ft::sort(big.begin(), big.end(), std::greater<int>());
+	LOG(SPEC(big.front() >= big.back()) << "Sorted with std::greater");
+
+	Algorithm_t	words[6] = {"pear", "apple", "fig", "banana", "apple", "cherry"};
+	ft::vector<Algorithm_t>	v(words, words + 6);
+
+	ft::sort(v.begin(), v.end());
+	print_range(v);
+	LOG("");
+}
+
+struct ByLength {
+	bool	operator () ( const Algorithm_t & a, const Algorithm_t & b ) const { return a.size() < b.size(); }
+};
+
+void	algorithm_test_stable_sort( void ) {
+	CASE("Stable sort");
+
+	Algorithm_t	words[8] = {"kiwi", "fig", "pear", "apple", "lime", "yam", "melon", "plum"};
+	ft::vector<Algorithm_t>	v(words, words + 8);
+
+	ft::stable_sort(v.begin(), v.end(), ByLength());
+	print_range(v);
+
+	unsigned int	seed = 7;
+	IntVector		big;
+
+	for (int i = 0; i < 3000; i++) {
+		big.push_back(next_random(seed));
+	}
+	ft::stable_sort(big.begin(), big.end());
+	LOG(SPEC(is_sorted_range(big)) << "3000 random ints are sorted");
+	LOG("");
+}
+
+void	algorithm_test_partial_sort( void ) {
+	CASE("Partial sort");
+
+	const int	numbers[10] = {5, -3, 9, 0, 9, -8, 2, 7, -3, 1};
+	IntVector	v(numbers, numbers + 10);
+
+	ft::partial_sort(v.begin(), v.begin() + 4, v.end());
+	print_range(IntVector(v.begin(), v.begin() + 4));
+	LOG("");
+}
+
+void	algorithm_test_nth_element( void ) {
+	CASE("Nth element");
+
+	unsigned int	seed = 1;
+	IntVector		v;
+
+	for (int i = 0; i < 1001; i++) {
+		v.push_back(next_random(seed));
+	}
+	IntVector	sorted(v);
+
+	ft::sort(sorted.begin(), sorted.end());
+	ft::nth_element(v.begin(), v.begin() + 500, v.end());
+	LOG("median: " << v[500]);
+	LOG(SPEC(v[500] == sorted[500]) << "Same as the sorted median");
+
+	bool	partitioned = true;
+	for (int i = 0; i < 1001; i++) {
+		partitioned &= i < 500 ? !(v[500] < v[i]) : !(v[i] < v[500]);
+	}
+	LOG(SPEC(partitioned) << "Partitioned around it");
+	LOG("");
+}
+
+void	algorithm_test_lower_upper_bound( void ) {
+	CASE("Lower / upper bound");
+
+	const int	numbers[9] = {-5, -1, 0, 0, 0, 3, 8, 8, 13};
+	IntVector	v(numbers, numbers + 9);
+
+	for (int val = -7; val <= 15; val += 2) {
+		LOG(val << ": lower_bound " << ft::lower_bound(v.begin(), v.end(), val) - v.begin()
+			<< ", upper_bound " << ft::upper_bound(v.begin(), v.end(), val) - v.begin());
+	}
+	LOG("0: lower_bound " << ft::lower_bound(v.begin(), v.end(), 0) - v.begin()
+		<< ", upper_bound " << ft::upper_bound(v.begin(), v.end(), 0) - v.begin());
+
+	IntVector	empty;
+
+	LOG(SPEC(ft::lower_bound(empty.begin(), empty.end(), 1) == empty.end()) << "Empty range");
+
+	std::list<int>	l(numbers, numbers + 9);
+
+	LOG("list: lower_bound(8) " << ft::distance(l.begin(), ft::lower_bound(l.begin(), l.end(), 8))
+		<< ", upper_bound(8) " << ft::distance(l.begin(), ft::upper_bound(l.begin(), l.end(), 8)));
+
+	ft::sort(v.begin(), v.end(), std::greater<int>());
+	LOG("descending: lower_bound(0) " << ft::lower_bound(v.begin(), v.end(), 0, std::greater<int>()) - v.begin()
+		<< ", upper_bound(0) " << ft::upper_bound(v.begin(), v.end(), 0, std::greater<int>()) - v.begin());
+	LOG("");
+}
+
+void	algorithm_test_binary_search( void ) {
+	CASE("Binary search");
+
+	unsigned int	seed = 3;
+	IntVector		v;
+
+	for (int i = 0; i < 2000; i++) {
+		v.push_back(next_random(seed));
+	}
+	ft::sort(v.begin(), v.end());
+
+	const int *	first = v.data();
+	const int *	last = first + v.size();
+	size_t		found = 0;
+	bool		consistent = true;
+
+	for (int val = -1001; val <= 1001; val++) {
+		bool	present = ft::binary_search(v.begin(), v.end(), val);
+
+		found += present;
+		consistent &= present == (std::find(first, last, val) != last);
+	}
+	LOG("found " << found << " of 2003 values");
+	LOG(SPEC(consistent) << "Agrees with a linear scan");
+
+	Algorithm_t	words[5] = {"apple", "banana", "cherry", "fig", "pear"};
+
+	LOG(SPEC(ft::binary_search(words, words + 5, Algorithm_t("fig"))) << "\"fig\" is found");
+	LOG(SPEC(!ft::binary_search(words, words + 5, Algorithm_t("grape"))) << "\"grape\" is not");
+	LOG("");
+}
+
+// lower_bound through an Eytzinger index, or the sorted vector it mirrors in std
+void	algorithm_test_eytzinger_index( void ) {
+	CASE("Eytzinger index");
+
+	unsigned int	seed = 11;
+	IntVector		sorted;
+
+	for (int i = 0; i < 1000; i++) {
+		sorted.push_back(next_random(seed));
+	}
+	ft::sort(sorted.begin(), sorted.end());
+
+#if !defined(STL)
+	ft::eytzinger_index<int>	index(sorted);
+
+	LOG("size: " << index.size());
+#else
+	LOG("size: " << sorted.size());
+#endif
+
+	const int *	first = sorted.data();
+	const int *	last = first + sorted.size();
+	size_t		found = 0;
+	bool		consistent = true;
+
+	for (int val = -1001; val <= 1001; val++) {
+		const int *	lower = std::lower_bound(first, last, val);
+		const int *	upper = std::upper_bound(first, last, val);
+		bool		present = lower != last && *lower == val;
+
+		found += present;
+#if !defined(STL)
+		const int *	l = index.lower_bound(val);
+		const int *	u = index.upper_bound(val);
+
+		consistent &= (l ? *l : INT_MAX) == (lower != last ? *lower : INT_MAX);
+		consistent &= (u ? *u : INT_MAX) == (upper != last ? *upper : INT_MAX);
+		consistent &= index.contains(val) == present;
+#else
+		(void)upper;
+#endif
+	}
+	LOG("found " << found << " of 2003 values");
+	LOG(SPEC(consistent) << "Agrees with the sorted vector");
+	LOG("");
+}
+
+struct Increment {
+	void	operator () ( int & x ) const { x++; }
+};
+
+struct Square {
+	long	operator () ( int x ) const { return static_cast<long>(x) * x; }
+};
+
+/*
+**	A pool of 4 threads and 100-element tasks, so the work is really split
+**	whatever the machine. std has no parallel algorithms in C++98: the
+**	serial ones give the expected output.
+*/
+void	algorithm_test_parallel( void ) {
+	CASE("Parallel algorithms");
+
+	unsigned int	seed = 5;
+	IntVector		v;
+
+	for (int i = 0; i < 10000; i++) {
+		v.push_back(next_random(seed));
+	}
+	ft::vector<long>	squares(v.size());
+	ft::vector<long>	sums(v.size());
+	long				total;
+
+#if defined(STL)
+	std::for_each(v.begin(), v.end(), Increment());
+	std::transform(v.begin(), v.end(), squares.begin(), Square());
+	total = std::accumulate(squares.begin(), squares.end(), 0L);
+	std::partial_sum(squares.begin(), squares.end(), sums.begin());
+	std::sort(v.begin(), v.end());
+#else
+	ft::thread_pool				pool(4);
+	ft::parallel::policy		policy(100, 1, &pool);
+
+	ft::parallel::for_each(v.begin(), v.end(), Increment(), policy);
+	ft::parallel::transform(v.begin(), v.end(), squares.begin(), Square(), policy);
+	total = ft::parallel::reduce(squares.begin(), squares.end(), 0L, policy);
+	ft::parallel::inclusive_scan(squares.begin(), squares.end(), sums.begin(), policy);
+	ft::parallel::sort(v.begin(), v.end(), policy);
+#endif
+	LOG("sum of squares: " << total);
+	LOG("running sums: " << sums[0] << ", " << sums[4999] << ", " << sums[9999]);
+	LOG(SPEC(sums.back() == total) << "Scan ends on the reduction");
+	LOG(SPEC(is_sorted_range(v)) << "10000 random ints are sorted");
+	LOG("min: " << v.front() << ", median: " << v[5000] << ", max: " << v.back());
+	LOG("");
+}
+
+void	algorithm_tests( void ) {
+	LOG("");
+	LOG(COLOR_LPURPLE("➤ Algorithm Tests"));
+	LOG("");
+	algorithm_test_equal_bytes();
+	algorithm_test_equal_pointers();
+	algorithm_test_lexicographical_compare_bytes();
+	algorithm_test_lexicographical_compare_signed();
+	algorithm_test_copy();
+	algorithm_test_copy_reverse();
+	algorithm_test_fill();
+	algorithm_test_remove_unique();
+	algorithm_test_sort();
+	algorithm_test_stable_sort();
+	algorithm_test_partial_sort();
+	algorithm_test_nth_element();
+	algorithm_test_lower_upper_bound();
+	algorithm_test_binary_search();
+	algorithm_test_eytzinger_index();
+	algorithm_test_parallel();
+}
@@ -0,0 +1,273 @@
+#include <cstdlib>
+
+#include "benchmarks/algorithm_benchmarks.hpp"
+
+#define SORT_BENCH_SIZE 1000000
+#define SEARCH_BENCH_LOOKUPS 1000000
+#define SEARCH_BENCH_SET_LIMIT (64 << 20) // bytes of keys; a set of 1 GB of ints won't fit in memory
+
+enum Shape { RANDOM, SORTED, REVERSED, FEW_UNIQUE };
+
+/*
+**	The same input for ft and std: srand is reset for every shape.
+*/
+template <typename T>
+ft::vector<T>	sort_bench_input( Shape shape, size_t n ) {
+	ft::vector<T>	v;
+
+	std::srand(42);
+	for (size_t i = 0; i < n; i++) {
+		switch (shape) {
+			case RANDOM:		v.push_back(static_cast<T>(std::rand() - RAND_MAX / 2)); break;
+			case SORTED:		v.push_back(static_cast<T>(i)); break;
+			case REVERSED:		v.push_back(static_cast<T>(n - i)); break;
+			case FEW_UNIQUE:	v.push_back(static_cast<T>(std::rand() % 16)); break;
+		}
+	}
+	return v;
+}
+
+template <>
+ft::vector<String>	sort_bench_input<String>( Shape shape, size_t n ) {
+	ft::vector<int>		keys = sort_bench_input<int>(shape, n);
+	ft::vector<String>	v;
+
+	for (size_t i = 0; i < n; i++) {
+		v.push_back(to_s(keys[i] + RAND_MAX)); // positive keys, so the text sorts like the numbers
+	}
+	return v;
+}
+
+template <typename T>
+double	sort_bench_sort( Shape shape, size_t n ) {
+	ft::vector<T>	v = sort_bench_input<T>(shape, n);
+	Timer			timer;
+
+	ft::sort(v.begin(), v.end());
+	consume(v.size());
+	return timer.elapsed();
+}
+
+template <typename T>
+double	sort_bench_stable_sort( Shape shape, size_t n ) {
+	ft::vector<T>	v = sort_bench_input<T>(shape, n);
+	Timer			timer;
+
+	ft::stable_sort(v.begin(), v.end());
+	consume(v.size());
+	return timer.elapsed();
+}
+
+template <typename T>
+double	sort_bench_partial_sort( size_t n, size_t k ) {
+	ft::vector<T>	v = sort_bench_input<T>(RANDOM, n);
+	Timer			timer;
+
+	ft::partial_sort(v.begin(), v.begin() + k, v.end());
+	consume(v.size());
+	return timer.elapsed();
+}
+
+template <typename T>
+double	sort_bench_nth_element( size_t n ) {
+	ft::vector<T>	v = sort_bench_input<T>(RANDOM, n);
+	Timer			timer;
+
+	ft::nth_element(v.begin(), v.begin() + n / 2, v.end());
+	consume(v.size());
+	return timer.elapsed();
+}
+
+template <typename T>
+void	sort_bench_shapes( const String & name, double (*bench)( Shape, size_t ), size_t n ) {
+	BENCH(name + " random", bench(RANDOM, n));
+	BENCH(name + " sorted", bench(SORTED, n));
+	BENCH(name + " reversed", bench(REVERSED, n));
+	BENCH(name + " few unique", bench(FEW_UNIQUE, n));
+}
+
+/*
+**	The aggregation jobs: an input and an output column of doubles filling
+**	bench_max_bytes(). std has no parallel algorithms in C++98, so bench_stl
+**	times the serial ones.
+*/
+struct Scale {
+	double	operator () ( double x ) const { return x * 1.0001 + 0.5; }
+};
+
+double	parallel_bench_reduce( const ft::vector<double> & v ) {
+	Timer	timer;
+#if defined(STL)
+	double	sum = std::accumulate(v.begin(), v.end(), 0.0);
+#else
+	double	sum = ft::parallel::reduce(v.begin(), v.end(), 0.0);
+#endif
+
+	consume(sum > 0);
+	return timer.elapsed();
+}
+
+double	parallel_bench_transform( const ft::vector<double> & v, ft::vector<double> & out ) {
+	Timer	timer;
+
+#if defined(STL)
+	std::transform(v.begin(), v.end(), out.begin(), Scale());
+#else
+	ft::parallel::transform(v.begin(), v.end(), out.begin(), Scale());
+#endif
+	consume(out[out.size() / 2] > 0);
+	return timer.elapsed();
+}
+
+double	parallel_bench_scan( const ft::vector<double> & v, ft::vector<double> & out ) {
+	Timer	timer;
+
+#if defined(STL)
+	std::partial_sum(v.begin(), v.end(), out.begin());
+#else
+	ft::parallel::inclusive_scan(v.begin(), v.end(), out.begin());
+#endif
+	consume(out.back() > 0);
+	return timer.elapsed();
+}
+
+double	parallel_bench_sort( size_t n ) {
+	ft::vector<int>	v = sort_bench_input<int>(RANDOM, n);
+	Timer			timer;
+
+#if defined(STL)
+	std::sort(v.begin(), v.end());
+#else
+	ft::parallel::sort(v.begin(), v.end());
+#endif
+	consume(v.front());
+	return timer.elapsed();
+}
+
+/*
+**	Keys are the even numbers below 2n and the lookups are spread over [0, 2n),
+**	so half of them miss. The lookup keys come from a fixed LCG.
+*/
+ft::vector<int>	search_bench_lookups( size_t n ) {
+	ft::vector<int>	lookups(SEARCH_BENCH_LOOKUPS);
+	unsigned long	seed = 42;
+
+	for (size_t i = 0; i < lookups.size(); i++) {
+		seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+		lookups[i] = static_cast<int>((seed >> 16) % (2 * n));
+	}
+	return lookups;
+}
+
+template <typename Search>
+double	search_bench_run( const Search & search, const ft::vector<int> & lookups ) {
+	Timer	timer;
+	size_t	found = 0;
+
+	for (size_t i = 0; i < lookups.size(); i++) {
+		found += search(lookups[i]);
+	}
+	consume(found);
+	return timer.elapsed();
+}
+
+struct LowerBound {
+	const ft::vector<int> &	keys;
+
+	explicit LowerBound( const ft::vector<int> & keys ) : keys(keys) { /* no-op */ }
+	size_t	operator () ( int key ) const { return ft::lower_bound(keys.begin(), keys.end(), key) - keys.begin(); }
+};
+
+struct BinarySearch {
+	const ft::vector<int> &	keys;
+
+	explicit BinarySearch( const ft::vector<int> & keys ) : keys(keys) { /* no-op */ }
+	size_t	operator () ( int key ) const { return ft::binary_search(keys.begin(), keys.end(), key); }
+};
+
+struct SetFind {
+	const ft::set<int> &	keys;
+
+	explicit SetFind( const ft::set<int> & keys ) : keys(keys) { /* no-op */ }
+	size_t	operator () ( int key ) const { return keys.find(key) != keys.end(); }
+};
+
+#if !defined(STL)
+struct EytzingerFind {
+	const ft::eytzinger_index<int> &	index;
+
+	explicit EytzingerFind( const ft::eytzinger_index<int> & index ) : index(index) { /* no-op */ }
+	size_t	operator () ( int key ) const { return index.contains(key); }
+};
+#endif
+
+void	search_bench_size( size_t bytes, const String & label ) {
+	size_t				n = bytes / sizeof(int);
+	ft::vector<int>		keys(n);
+	ft::vector<int>		lookups = search_bench_lookups(n);
+
+	for (size_t i = 0; i < n; i++) {
+		keys[i] = static_cast<int>(2 * i);
+	}
+	BENCH(label + " lower_bound", search_bench_run(LowerBound(keys), lookups));
+	BENCH(label + " binary_search", search_bench_run(BinarySearch(keys), lookups));
+#if !defined(STL)
+	{
+		ft::eytzinger_index<int>	index(keys);
+
+		BENCH(label + " eytzinger_index", search_bench_run(EytzingerFind(index), lookups));
+	}
+#endif
+	if (bytes <= SEARCH_BENCH_SET_LIMIT) {
+		ft::set<int>	set(keys.begin(), keys.end());
+
+		BENCH(label + " set::find", search_bench_run(SetFind(set), lookups));
+	}
+}
+
+void	algorithm_benchmarks( void ) {
+	LOG("");
+	CASE("Algorithm - sort (" << SORT_BENCH_SIZE << " elements)");
+	sort_bench_shapes<int>("vector<int>", sort_bench_sort<int>, SORT_BENCH_SIZE);
+	sort_bench_shapes<unsigned long>("vector<unsigned long>", sort_bench_sort<unsigned long>, SORT_BENCH_SIZE);
+	sort_bench_shapes<double>("vector<double>", sort_bench_sort<double>, SORT_BENCH_SIZE);
+	sort_bench_shapes<String>("vector<string>", sort_bench_sort<String>, SORT_BENCH_SIZE / 10);
+
+	LOG("");
+	CASE("Algorithm - stable_sort (" << SORT_BENCH_SIZE << " elements)");
+	sort_bench_shapes<int>("vector<int>", sort_bench_stable_sort<int>, SORT_BENCH_SIZE);
+	sort_bench_shapes<String>("vector<string>", sort_bench_stable_sort<String>, SORT_BENCH_SIZE / 10);
+
+	LOG("");
+	CASE("Algorithm - selection (" << SORT_BENCH_SIZE << " random ints)");
+	BENCH("partial_sort first 100", sort_bench_partial_sort<int>(SORT_BENCH_SIZE, 100));
+	BENCH("partial_sort first half", sort_bench_partial_sort<int>(SORT_BENCH_SIZE, SORT_BENCH_SIZE / 2));
+	BENCH("nth_element median", sort_bench_nth_element<int>(SORT_BENCH_SIZE));
+
+	LOG("");
+	CASE("Algorithm - search (" << SEARCH_BENCH_LOOKUPS << " lookups of int keys, half missing)");
+	search_bench_size(16 << 10, "16 KB (L1)");
+	search_bench_size(512 << 10, "512 KB (L2)");
+	search_bench_size(8 << 20, "8 MB (L3)");
+	for (size_t bytes = 64 << 20; bytes <= bench_max_bytes(); bytes *= 4) {
+		search_bench_size(bytes, to_s(bytes >> 20) + " MB");
+	}
+
+	size_t	parallel_size = bench_max_bytes() / (2 * sizeof(double));
+	size_t	parallel_sort_size = bench_max_bytes() / (2 * sizeof(int)); // the merge buffer doubles it
+
+	LOG("");
+	CASE("Algorithm - parallel (" << parallel_size << " doubles)");
+#if !defined(STL)
+	BENCH_COUNT("threads", ft::thread_pool::shared().size());
+#endif
+	{
+		ft::vector<double>	v(parallel_size, 1.0);
+		ft::vector<double>	out(parallel_size);
+
+		BENCH("reduce", parallel_bench_reduce(v));
+		BENCH("transform", parallel_bench_transform(v, out));
+		BENCH("inclusive_scan", parallel_bench_scan(v, out));
+	}
+	BENCH("sort " + to_s(parallel_sort_size) + " ints", parallel_bench_sort(parallel_sort_size));
+}
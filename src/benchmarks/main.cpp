@@ -0,0 +1,48 @@
+#include <map>
+
+#include "benchmarks/vector_benchmarks.hpp"
+#include "benchmarks/stack_benchmarks.hpp"
+#include "benchmarks/algorithm_benchmarks.hpp"
+#include "benchmarks/map_benchmarks.hpp"
+
+# define VECTOR  "vector"
+# define STACK   "stack"
+# define ALGORITHM "algorithm"
+# define MAP     "map"
+
+typedef std::map<String, bool>	Benchmarks;
+
+volatile size_t	bench_sink = 0;
+size_t			bench_allocations = 0;
+
+int	print_usage( char *name ) {
+	ERROR("Usage: " << name << " [containers = all]");
+	ERROR("  containers:  " << VECTOR << " / " << STACK << " / " << ALGORITHM << " / " << MAP);
+	return 1;
+}
+
+int	main( int argc, char **argv ) {
+	Benchmarks	benchmarks;
+
+	benchmarks[VECTOR]	= argc == 1;
+	benchmarks[STACK]	= argc == 1;
+	benchmarks[ALGORITHM]	= argc == 1;
+	benchmarks[MAP]		= argc == 1;
+
+	for (int i = 1; i < argc; i++) {
+		String	benchmark(argv[i]);
+
+		if (!benchmarks.count(benchmark)) {
+			return print_usage(*argv);
+		}
+		benchmarks[benchmark] = true;
+	}
+
+	LOG(COLOR_LPURPLE("➤ Benchmarks (" << BENCH_TARGET << ")"));
+	if (benchmarks[VECTOR])	vector_benchmarks();
+	if (benchmarks[STACK])	stack_benchmarks();
+	if (benchmarks[ALGORITHM])	algorithm_benchmarks();
+	if (benchmarks[MAP])	map_benchmarks();
+
+	return 0;
+}
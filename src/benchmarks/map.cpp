@@ -0,0 +1,196 @@
+#if defined(DARWIN)
+	# include <malloc/malloc.h>
+#else
+	# include <malloc.h>
+#endif
+
+#include "benchmarks/map_benchmarks.hpp"
+
+#define MAP_BENCH_SIZE 1000000
+
+// Bytes of heap in use, chunk headers and mmapped blocks included
+static size_t	map_bench_heap( void ) {
+#if defined(DARWIN)
+	return mstats().bytes_used;
+#else
+	struct mallinfo2	info = mallinfo2();
+
+	return info.uordblks + info.hblkhd;
+#endif
+}
+
+static int	map_bench_key( unsigned long & seed ) {
+	seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+	return static_cast<int>(seed >> 33);
+}
+
+/*
+**	Fills a map, then erases a random key and inserts another, n times: the
+**	steady state of a cache or an order book, where nodes are freed and
+**	allocated all the time.
+*/
+template <typename Map>
+void	map_bench_churn( const String & name, size_t n ) {
+	Map				m;
+	unsigned long	seed = 42;
+	Timer			timer;
+
+	for (size_t i = 0; i < n; i++) {
+		m.insert(typename Map::value_type(map_bench_key(seed), static_cast<int>(i)));
+	}
+	BENCH(name + " fill", timer.elapsed());
+
+	unsigned long	erase_seed = 42;
+
+	timer.reset();
+	for (size_t i = 0; i < n; i++) {
+		m.erase(map_bench_key(erase_seed));
+		m.insert(typename Map::value_type(map_bench_key(seed), static_cast<int>(i)));
+	}
+	BENCH(name + " erase + insert", timer.elapsed());
+
+	timer.reset();
+	m.clear();
+	BENCH(name + " clear", timer.elapsed());
+	consume(m.size());
+}
+
+/*
+**	Inserts n keys drawn from `distinct` values: with few distinct values
+**	most inserts find their key already there.
+*/
+template <typename Map>
+void	map_bench_ingest( const String & name, size_t n, size_t distinct ) {
+	Map				m;
+	unsigned long	seed = 42;
+	size_t			added = 0;
+	Timer			timer;
+
+	for (size_t i = 0; i < n; i++) {
+		int	key = static_cast<int>(static_cast<size_t>(map_bench_key(seed)) % distinct);
+
+		added += m.insert(typename Map::value_type(key, static_cast<int>(i))).second;
+	}
+	BENCH(name + " insert", timer.elapsed());
+	consume(added);
+}
+
+/*
+**	Ascending keys, like timestamps, then the oldest entry read and erased
+**	until the map is empty: the ends of the tree are hit on every step.
+*/
+template <typename Map>
+void	map_bench_ends( const String & name, size_t n ) {
+	Map		m;
+	Timer	timer;
+
+	for (size_t i = 0; i < n; i++) {
+		m.insert(typename Map::value_type(static_cast<int>(i), 0));
+		consume(m.rbegin()->first);
+	}
+	BENCH(name + " ascending insert + rbegin", timer.elapsed());
+
+	timer.reset();
+	while (!m.empty()) {
+		consume(m.begin()->first);
+		m.erase(m.begin());
+	}
+	BENCH(name + " begin + erase(begin)", timer.elapsed());
+}
+
+/*
+**	Full scans, both ways. Filled in ascending order the nodes sit in memory
+**	in key order and the scan times the stepping itself; in random order it
+**	mostly times cache misses.
+*/
+template <typename Map>
+void	map_bench_scan( const String & name, size_t n, bool ascending ) {
+	Map				m;
+	unsigned long	seed = 42;
+
+	for (int i = 0; m.size() < n; i++) {
+		m.insert(typename Map::value_type(ascending ? i : map_bench_key(seed), 1));
+	}
+
+	Timer	timer;
+	size_t	sum = 0;
+
+	for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it) {
+		sum += it->second;
+	}
+	BENCH(name + " forward scan", timer.elapsed());
+
+	timer.reset();
+	for (typename Map::const_reverse_iterator it = m.rbegin(); it != m.rend(); ++it) {
+		sum += it->second;
+	}
+	BENCH(name + " reverse scan", timer.elapsed());
+	consume(sum);
+}
+
+// Heap growth while filling a map, per element
+template <typename Map>
+void	map_bench_memory( const String & name, size_t n ) {
+	size_t			before = map_bench_heap();
+	Map				m;
+	unsigned long	seed = 7;
+
+	while (m.size() < n) {
+		m.insert(typename Map::value_type(map_bench_key(seed), 0));
+	}
+	BENCH_COUNT(name + " heap bytes per node", (map_bench_heap() - before) / n);
+}
+
+// Many small maps: what an empty one costs to build and keep around
+template <typename Map>
+void	map_bench_empty( const String & name, size_t n ) {
+	size_t			before = map_bench_heap();
+	Timer			timer;
+	Map *			maps = new Map[n];
+
+	BENCH(name + " construct", timer.elapsed());
+	BENCH_COUNT(name + " sizeof", sizeof(Map));
+	BENCH_COUNT(name + " heap bytes per map beyond it", (map_bench_heap() - before) / n - sizeof(Map));
+	timer.reset();
+	delete [] maps;
+	BENCH(name + " destroy", timer.elapsed());
+}
+
+void	map_benchmarks( void ) {
+	typedef ft::map<int, int>	Map;
+#if !defined(STL)
+	typedef ft::map< int, int, std::less<int>, ft::pool_allocator< ft::pair<const int, int> > >	PoolMap;
+#endif
+
+	LOG("");
+	CASE("Map - insert / erase churn (" << MAP_BENCH_SIZE << " int pairs)");
+	map_bench_churn<Map>("map", MAP_BENCH_SIZE);
+#if !defined(STL)
+	map_bench_churn<PoolMap>("map pool", MAP_BENCH_SIZE);
+#endif
+
+	LOG("");
+	CASE("Map - ingest (" << MAP_BENCH_SIZE * 2 << " inserts)");
+	map_bench_ingest<Map>("map 100000 distinct keys", MAP_BENCH_SIZE * 2, 100000);
+	map_bench_ingest<Map>("map all distinct", MAP_BENCH_SIZE * 2, MAP_BENCH_SIZE * 2000);
+
+	LOG("");
+	CASE("Map - both ends (" << MAP_BENCH_SIZE << " int pairs)");
+	map_bench_ends<Map>("map", MAP_BENCH_SIZE);
+
+	LOG("");
+	CASE("Map - full scan (" << MAP_BENCH_SIZE * 4 << " int pairs)");
+	map_bench_scan<Map>("map ascending", MAP_BENCH_SIZE * 4, true);
+	map_bench_scan<Map>("map random", MAP_BENCH_SIZE * 4, false);
+
+	LOG("");
+	CASE("Map - memory (" << MAP_BENCH_SIZE * 4 << " int pairs)");
+	map_bench_memory<Map>("map", MAP_BENCH_SIZE * 4);
+#if !defined(STL)
+	map_bench_memory<PoolMap>("map pool", MAP_BENCH_SIZE * 4);
+#endif
+
+	LOG("");
+	CASE("Map - empty maps (" << MAP_BENCH_SIZE << ")");
+	map_bench_empty<Map>("map", MAP_BENCH_SIZE);
+}
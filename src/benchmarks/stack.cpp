@@ -0,0 +1,58 @@
+#include <time.h>
+#include <algorithm>
+#include <vector>
+
+#include "benchmarks/stack_benchmarks.hpp"
+
+#define STACK_BENCH_SIZE 8000000
+
+static unsigned long	stack_bench_now( void ) {
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000UL + ts.tv_nsec;
+} // nanoseconds
+
+/*
+**	Times every push on its own and reports the latency distribution: the
+**	mean hides the pushes that reallocate, the tail percentiles don't.
+*/
+template <typename Stack>
+void	stack_bench_push_latency( const String & name, size_t n ) {
+	std::vector<unsigned>	samples(n);
+	Stack					s;
+	Timer					timer;
+
+	for (size_t i = 0; i < n; i++) {
+		unsigned long	start = stack_bench_now();
+
+		s.push(i);
+		samples[i] = static_cast<unsigned>(stack_bench_now() - start);
+	}
+	double	total = timer.elapsed();
+
+	timer.reset();
+	while (!s.empty()) {
+		consume(s.top());
+		s.pop();
+	}
+	double	drain = timer.elapsed();
+
+	std::sort(samples.begin(), samples.end());
+	BENCH(name + " push total", total);
+	BENCH_COUNT(name + " push p50 (ns)", samples[n / 2]);
+	BENCH_COUNT(name + " push p99 (ns)", samples[n / 100 * 99]);
+	BENCH_COUNT(name + " push p99.9 (ns)", samples[n / 1000 * 999]);
+	BENCH_COUNT(name + " push max (ns)", samples[n - 1]);
+	BENCH(name + " pop total", drain);
+}
+
+void	stack_benchmarks( void ) {
+	typedef ft::stack< size_t, ft::vector<size_t> >	VectorStack;
+	typedef ft::stack< size_t, ft::deque<size_t> >	DequeStack;
+
+	LOG("");
+	CASE("Stack - push latency (" << STACK_BENCH_SIZE << " size_t, vector vs deque backing)");
+	stack_bench_push_latency<VectorStack>("stack<vector>", STACK_BENCH_SIZE);
+	stack_bench_push_latency<DequeStack>("stack<deque>", STACK_BENCH_SIZE);
+}
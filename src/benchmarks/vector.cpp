@@ -0,0 +1,564 @@
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cstdio>
+#include <fstream>
+
+#include "benchmarks/vector_benchmarks.hpp"
+
+#define VECTOR_BENCH_SIZE 1000000
+
+template <typename T, typename Allocator>
+double	vector_bench_push_back( const T & val, size_t n ) {
+	Timer						timer;
+	ft::vector<T, Allocator>	v;
+
+	for (size_t i = 0; i < n; i++) {
+		v.push_back(val);
+	}
+	consume(v.size());
+	return timer.elapsed();
+}
+
+template <typename T>
+double	vector_bench_push_back( const T & val, size_t n ) {
+	return vector_bench_push_back< T, std::allocator<T> >(val, n);
+}
+
+template <typename T>
+double	vector_bench_insert_middle( const T & val, size_t n ) {
+	Timer			timer;
+	ft::vector<T>	v;
+
+	for (size_t i = 0; i < n; i++) {
+		v.insert(v.begin() + v.size() / 2, val);
+	}
+	while (!v.empty()) {
+		v.erase(v.begin() + v.size() / 2);
+	}
+	consume(v.size());
+	return timer.elapsed();
+}
+
+template <typename T>
+double	vector_bench_reassign( const T & val, size_t n, size_t rounds ) {
+	const ft::vector<T>	templates[2] = { ft::vector<T>(n, val), ft::vector<T>(n / 2, val) };
+	ft::vector<T>		scratch;
+	Timer				timer;
+
+	for (size_t i = 0; i < rounds; i++) {
+		scratch = templates[i % 2];
+		consume(scratch.size());
+	}
+	return timer.elapsed();
+}
+
+template <typename T>
+double	vector_bench_fill( const T & val, size_t n, size_t rounds ) {
+	Timer	timer;
+
+	for (size_t i = 0; i < rounds; i++) {
+		ft::vector<T>	filled(n, val);
+		ft::vector<T>	resized;
+
+		resized.resize(n, val);
+		consume(filled.size() + resized.size());
+	}
+	return timer.elapsed();
+}
+
+#if !defined(STL)
+double	vector_bench_resize_default_init( size_t n, size_t rounds ) {
+	Timer	timer;
+
+	for (size_t i = 0; i < rounds; i++) {
+		ft::vector<char>	buffer;
+
+		buffer.resize_default_init(n);
+		consume(buffer.size());
+	}
+	return timer.elapsed();
+}
+#endif
+
+/*
+**	Builds `rounds` vectors of n elements and returns how many allocations
+**	that took.
+*/
+template <typename Vector>
+size_t	vector_bench_allocations( size_t n, size_t rounds ) {
+	size_t	before = bench_allocations;
+
+	for (size_t i = 0; i < rounds; i++) {
+		Vector	v;
+
+		for (size_t j = 0; j < n; j++) {
+			v.push_back(static_cast<typename Vector::value_type>(j));
+		}
+		consume(v.size());
+	}
+	return bench_allocations - before;
+}
+
+template <typename Vector>
+double	vector_bench_short( size_t n, size_t rounds ) {
+	Timer	timer;
+
+	vector_bench_allocations<Vector>(n, rounds);
+	return timer.elapsed();
+}
+
+/*
+**	Startup cost of n records kept on disk: parsing a text dump into a vector
+**	against mapping a file written by mapped_vector.
+*/
+double	vector_bench_load_text( const char * path, size_t n ) {
+	{
+		std::ofstream	out(path);
+
+		for (size_t i = 0; i < n; i++) {
+			out << i << '\n';
+		}
+	}
+
+	Timer				timer;
+	std::ifstream		in(path);
+	ft::vector<size_t>	v;
+	size_t				record;
+
+	while (in >> record) {
+		v.push_back(record);
+	}
+	consume(v.back());
+	std::remove(path);
+	return timer.elapsed();
+}
+
+#if !defined(STL)
+double	vector_bench_load_mapped( const char * path, size_t n ) {
+	{
+		ft::mapped_vector<size_t>	out(path);
+
+		for (size_t i = 0; i < n; i++) {
+			out.push_back(i);
+		}
+	}
+
+	Timer	timer;
+	{
+		ft::mapped_vector<size_t>	v(path, ft::mapped_vector<size_t>::read_only);
+
+		consume(v.back());
+	}
+	std::remove(path);
+	return timer.elapsed();
+}
+#endif
+
+/*
+**	Compares two n element vectors that only differ, if at all, on their last
+**	element: the worst case for both operators. Touching that element every
+**	round keeps the compiler from merging or hoisting the comparisons.
+*/
+template <typename T>
+double	vector_bench_compare( size_t n, size_t rounds ) {
+	const ft::vector<T>	a(n, T(7));
+	ft::vector<T>		b(a);
+	Timer				timer;
+
+	for (size_t i = 0; i < rounds; i++) {
+		b.back() = T(7 + i % 2);
+		consume(a == b);
+		b.back() = T(7 - i % 2);
+		consume(a < b);
+	}
+	return timer.elapsed();
+}
+
+/*
+**	y = a * x + y over float buffers, the kind of loop the compiler vectorizes.
+*/
+inline void	vector_bench_saxpy_kernel( float * y, const float * x, float a, size_t n ) {
+	for (size_t i = 0; i < n; i++) {
+		y[i] = a * x[i] + y[i];
+	}
+}
+
+template <typename Vector>
+double	vector_bench_saxpy( size_t n, size_t rounds ) {
+	Vector	x(n, 1.5f);
+	Vector	y(n, 0.5f);
+	Timer	timer;
+
+	for (size_t i = 0; i < rounds; i++) {
+		vector_bench_saxpy_kernel(y.data(), x.data(), 0.5f, n);
+	}
+	consume(y[n / 2]);
+	return timer.elapsed();
+}
+
+#if !defined(STL)
+template <typename Vector>
+double	vector_bench_saxpy_aligned( size_t n, size_t rounds ) {
+	Vector	x(n, 1.5f);
+	Vector	y(n, 0.5f);
+	Timer	timer;
+
+	for (size_t i = 0; i < rounds; i++) {
+		vector_bench_saxpy_kernel(y.aligned_data(), x.aligned_data(), 0.5f, n);
+	}
+	consume(y[n / 2]);
+	return timer.elapsed();
+}
+#endif
+
+/*
+**	Runs in a child process so that ru_maxrss only accounts for this vector.
+*/
+template <typename Vector>
+void	vector_bench_growth( const String & name, size_t n ) {
+	pid_t	pid = fork();
+
+	if (pid == 0) {
+		Timer	timer;
+		Vector	v;
+
+		for (size_t i = 0; i < n; i++) {
+			v.push_back(static_cast<typename Vector::value_type>(i));
+		}
+		consume(v.size());
+		BENCH(name + " push_back", timer.elapsed());
+		BENCH_COUNT(name + " capacity", v.capacity());
+		_exit(0);
+	}
+
+	struct rusage	usage;
+	int				status;
+
+	wait4(pid, &status, 0, &usage);
+	BENCH_COUNT(name + " peak RSS (KiB)", usage.ru_maxrss);
+}
+
+/*
+**	Rows of an int key and a double value, 16 bytes each with the padding.
+**	A key scan drags all 16 through the cache in the AoS layout, 4 in SoA.
+*/
+typedef ft::pair<int, double>	BenchRow;
+
+template <typename Rows>
+Rows	vector_bench_rows( size_t n ) {
+	Rows			rows;
+	unsigned long	seed = 42;
+
+	rows.reserve(n);
+	for (size_t i = 0; i < n; i++) {
+		seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+		rows.push_back(BenchRow(static_cast<int>(seed >> 40), static_cast<double>(i)));
+	}
+	return rows;
+}
+
+template <typename Rows>
+double	vector_bench_scan_keys( const Rows & rows, size_t rounds ) {
+	Timer	timer;
+	long	sum = 0;
+
+	for (size_t r = 0; r < rounds; r++) {
+		for (size_t i = 0; i < rows.size(); i++) {
+			sum += rows[i].first;
+		}
+	}
+	consume(sum);
+	return timer.elapsed();
+}
+
+#if !defined(STL)
+template <typename Rows>
+double	vector_bench_scan_key_column( const Rows & rows, size_t rounds ) {
+	Timer		timer;
+	long		sum = 0;
+	const int *	keys = rows.keys();
+
+	for (size_t r = 0; r < rounds; r++) {
+		for (size_t i = 0; i < rows.size(); i++) {
+			sum += keys[i];
+		}
+	}
+	consume(sum);
+	return timer.elapsed();
+}
+#endif
+
+template <typename Rows>
+double	vector_bench_sort_rows( size_t n ) {
+	Rows	rows = vector_bench_rows<Rows>(n);
+	Timer	timer;
+
+	ft::sort(rows.begin(), rows.end());
+	consume(rows.size());
+	return timer.elapsed();
+}
+
+/*
+**	An expiry sweep: drop the 1 in 4 elements the predicate flags, element by
+**	element with erase(it) or in one pass with erase_if.
+*/
+struct BenchExpired {
+	bool	operator () ( int x ) const { return x % 4 == 0; }
+	bool	operator () ( const String & x ) const { return x.size() % 4 == 0; }
+};
+
+int		vector_bench_expiry_value( size_t i, int ) { return static_cast<int>(i); }
+String	vector_bench_expiry_value( size_t i, const String & ) { return String(16 + i % 4, 'x'); }
+
+template <typename T>
+ft::vector<T>	vector_bench_expiry_input( size_t n ) {
+	ft::vector<T>	v;
+
+	v.reserve(n);
+	for (size_t i = 0; i < n; i++) {
+		v.push_back(vector_bench_expiry_value(i, T()));
+	}
+	return v;
+}
+
+template <typename T>
+double	vector_bench_erase_loop( size_t n ) {
+	ft::vector<T>	v = vector_bench_expiry_input<T>(n);
+	Timer			timer;
+
+	for (typename ft::vector<T>::iterator it = v.begin(); it != v.end();) {
+		it = BenchExpired()(*it) ? v.erase(it) : it + 1;
+	}
+	consume(v.size());
+	return timer.elapsed();
+}
+
+template <typename T>
+double	vector_bench_erase_if( size_t n ) {
+	ft::vector<T>	v = vector_bench_expiry_input<T>(n);
+	Timer			timer;
+
+#if defined(STL)
+	v.erase(std::remove_if(v.begin(), v.end(), BenchExpired()), v.end());
+#else
+	ft::erase_if(v, BenchExpired());
+#endif
+	consume(v.size());
+	return timer.elapsed();
+}
+
+/*
+**	Membership bitmaps: 1 bit in `every` set. The bit by bit loops are what a
+**	vector<bool> without word operations has to do, in both builds.
+*/
+#define BITMAP_BENCH_SIZE (size_t(1) << 29)
+
+ft::vector<bool>	vector_bench_bitmap( size_t n, size_t every ) {
+	ft::vector<bool>	bits(n);
+	unsigned long		seed = 7;
+
+	for (size_t i = 0; i < n / every; i++) {
+		seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+		bits[(seed >> 16) % n] = true;
+	}
+	return bits;
+}
+
+double	vector_bench_bitmap_count_bits( const ft::vector<bool> & bits ) {
+	Timer	timer;
+	size_t	n = 0;
+
+	for (size_t i = 0; i < bits.size(); i++) {
+		n += bits[i];
+	}
+	consume(n);
+	return timer.elapsed();
+}
+
+double	vector_bench_bitmap_scan_bits( const ft::vector<bool> & bits ) {
+	Timer	timer;
+	size_t	sum = 0;
+
+	for (size_t i = 0; i < bits.size(); i++) {
+		if (bits[i]) {
+			sum += i;
+		}
+	}
+	consume(sum);
+	return timer.elapsed();
+}
+
+double	vector_bench_bitmap_and_bits( ft::vector<bool> & bits, const ft::vector<bool> & mask ) {
+	Timer	timer;
+
+	for (size_t i = 0; i < bits.size(); i++) {
+		bits[i] = bits[i] && mask[i];
+	}
+	consume(bits[0]);
+	return timer.elapsed();
+}
+
+#if !defined(STL)
+double	vector_bench_bitmap_count( const ft::vector<bool> & bits ) {
+	Timer	timer;
+
+	consume(bits.count());
+	return timer.elapsed();
+}
+
+double	vector_bench_bitmap_scan( const ft::vector<bool> & bits ) {
+	Timer	timer;
+	size_t	sum = 0;
+
+	for (size_t i = bits.find_first(); i != bits.npos; i = bits.find_next(i)) {
+		sum += i;
+	}
+	consume(sum);
+	return timer.elapsed();
+}
+
+double	vector_bench_bitmap_and( ft::vector<bool> & bits, const ft::vector<bool> & mask ) {
+	Timer	timer;
+
+	bits &= mask;
+	consume(bits[0]);
+	return timer.elapsed();
+}
+#endif
+
+void	vector_benchmarks( void ) {
+	LOG("");
+	CASE("Vector - push_back growth (" << VECTOR_BENCH_SIZE << " elements, no reserve)");
+	BENCH("vector<int>", vector_bench_push_back<int>(42, VECTOR_BENCH_SIZE));
+	BENCH("vector<double>", vector_bench_push_back<double>(4.2, VECTOR_BENCH_SIZE));
+	BENCH("vector<string> (short)", vector_bench_push_back<String>("short", VECTOR_BENCH_SIZE));
+	BENCH("vector<string> (long)", vector_bench_push_back<String>(String(64, 'x'), VECTOR_BENCH_SIZE));
+	BENCH("vector<vector<int> >", vector_bench_push_back< ft::vector<int> >(ft::vector<int>(16, 1), VECTOR_BENCH_SIZE / 10));
+
+	LOG("");
+	CASE("Vector - insert then erase in the middle");
+	BENCH("vector<int> (50000 elements)", vector_bench_insert_middle<int>(42, 50000));
+	BENCH("vector<string> (10000 elements)", vector_bench_insert_middle<String>("short", 10000));
+
+	LOG("");
+	CASE("Vector - reassign a scratch vector from a template");
+	BENCH("vector<int> (1000 elements x 100000)", vector_bench_reassign<int>(42, 1000, 100000));
+	BENCH("vector<string> (100 elements x 100000)", vector_bench_reassign<String>("short", 100, 100000));
+
+	LOG("");
+	CASE("Vector - fill constructor + resize (" << VECTOR_BENCH_SIZE << " elements x 20)");
+	BENCH("vector<int> (0)", vector_bench_fill<int>(0, VECTOR_BENCH_SIZE, 20));
+	BENCH("vector<int> (42)", vector_bench_fill<int>(42, VECTOR_BENCH_SIZE, 20));
+	BENCH("vector<double> (4.2)", vector_bench_fill<double>(4.2, VECTOR_BENCH_SIZE, 20));
+	BENCH("vector<char> ('x')", vector_bench_fill<char>('x', VECTOR_BENCH_SIZE, 20));
+	BENCH("vector<string> (short)", vector_bench_fill<String>("short", VECTOR_BENCH_SIZE / 10, 20));
+#if !defined(STL)
+	BENCH("vector<char> resize_default_init", vector_bench_resize_default_init(VECTOR_BENCH_SIZE, 20));
+#endif
+
+	LOG("");
+	CASE("Vector - short vectors (100000 vectors of 0 to 8 ints)");
+	for (size_t n = 0; n <= 8; n++) {
+		typedef ft::vector< int, counting_allocator<int> >	Vector;
+
+		BENCH("vector<int> size " + to_s(n), vector_bench_short<Vector>(n, 100000));
+		BENCH_COUNT("vector<int> size " + to_s(n) + " allocations", vector_bench_allocations<Vector>(n, 100000));
+#if !defined(STL)
+		typedef ft::small_vector< int, 8, counting_allocator<int> >	SmallVector;
+
+		BENCH("small_vector<int, 8> size " + to_s(n), vector_bench_short<SmallVector>(n, 100000));
+		BENCH_COUNT("small_vector<int, 8> size " + to_s(n) + " allocations", vector_bench_allocations<SmallVector>(n, 100000));
+#endif
+	}
+
+	LOG("");
+	CASE("Vector - load " << VECTOR_BENCH_SIZE << " records from disk");
+	BENCH("vector<size_t> from text", vector_bench_load_text("/tmp/bench_vector.txt", VECTOR_BENCH_SIZE));
+#if !defined(STL)
+	BENCH("mapped_vector<size_t> read only", vector_bench_load_mapped("/tmp/bench_vector.bin", VECTOR_BENCH_SIZE));
+#endif
+
+	LOG("");
+	CASE("Vector - == and < on nearly equal vectors (8 MiB x 100)");
+	BENCH("vector<unsigned char>", vector_bench_compare<unsigned char>(8 << 20, 100));
+	BENCH("vector<int>", vector_bench_compare<int>(2 << 20, 100));
+	BENCH("vector<double>", vector_bench_compare<double>(1 << 20, 100));
+
+	LOG("");
+	CASE("Vector - saxpy over floats (1000 elements x 1000000)");
+	BENCH("vector<float> data()", vector_bench_saxpy< ft::vector<float> >(1000, 1000000));
+#if !defined(STL)
+	BENCH("vector<float> (64 aligned) aligned_data()",
+		(vector_bench_saxpy_aligned< ft::vector< float, ft::aligned_allocator<float, 64> > >(1000, 1000000)));
+#endif
+
+	// Grown without reserve: old and new blocks coexist, up to 3x the elements
+	size_t	ingest_size = bench_max_bytes() / (3 * sizeof(int));
+	size_t	row_count = bench_max_bytes() / (3 * sizeof(BenchRow));
+
+	LOG("");
+	CASE("Vector - growth policies (" << ingest_size << " ints)");
+#if defined(STL)
+	vector_bench_growth< ft::vector<int> >("std", ingest_size);
+#else
+	vector_bench_growth< ft::vector<int, std::allocator<int>, ft::factor_growth<2, 1> > >("2x", ingest_size);
+	vector_bench_growth< ft::vector<int, std::allocator<int>, ft::factor_growth<3, 2> > >("1.5x", ingest_size);
+	vector_bench_growth< ft::vector<int, std::allocator<int>, ft::page_growth<4096> > >("4 KiB pages", ingest_size);
+	vector_bench_growth< ft::vector<int, std::allocator<int>, ft::page_growth<2097152> > >("2 MiB pages", ingest_size);
+	vector_bench_growth< ft::vector<int, ft::mmap_allocator<int> > >("2x mremap", ingest_size);
+#endif
+
+	LOG("");
+	CASE("Vector - bulk ingest (" << ingest_size << " ints, no reserve)");
+	BENCH("vector<int>", vector_bench_push_back<int>(42, ingest_size));
+#if !defined(STL)
+	BENCH("vector<int, mmap_allocator>", (vector_bench_push_back< int, ft::mmap_allocator<int> >(42, ingest_size)));
+#endif
+
+	LOG("");
+	CASE("Vector - pair<int, double> rows, AoS vs SoA (" << row_count << " rows)");
+	{
+		const ft::vector<BenchRow>	aos = vector_bench_rows< ft::vector<BenchRow> >(row_count);
+
+		BENCH("vector<pair> key scan x 10", vector_bench_scan_keys(aos, 10));
+	}
+#if !defined(STL)
+	{
+		const ft::soa_vector<BenchRow>	soa = vector_bench_rows< ft::soa_vector<BenchRow> >(row_count);
+
+		BENCH("soa_vector<pair> key scan x 10", vector_bench_scan_keys(soa, 10));
+		BENCH("soa_vector<pair> keys() scan x 10", vector_bench_scan_key_column(soa, 10));
+	}
+#endif
+	BENCH("vector<pair> sort", vector_bench_sort_rows< ft::vector<BenchRow> >(VECTOR_BENCH_SIZE));
+#if !defined(STL)
+	BENCH("soa_vector<pair> sort", vector_bench_sort_rows< ft::soa_vector<BenchRow> >(VECTOR_BENCH_SIZE));
+#endif
+
+	LOG("");
+	CASE("Vector - expiry sweep, 1 in 4 elements erased");
+	BENCH("vector<int> erase(it) loop (100000)", vector_bench_erase_loop<int>(100000));
+	BENCH("vector<int> erase_if (100000)", vector_bench_erase_if<int>(100000));
+	BENCH("vector<int> erase_if (" + to_s(VECTOR_BENCH_SIZE * 5) + ")", vector_bench_erase_if<int>(VECTOR_BENCH_SIZE * 5));
+	BENCH("vector<string> erase(it) loop (20000)", vector_bench_erase_loop<String>(20000));
+	BENCH("vector<string> erase_if (20000)", vector_bench_erase_if<String>(20000));
+	BENCH("vector<string> erase_if (" + to_s(VECTOR_BENCH_SIZE * 5) + ")", vector_bench_erase_if<String>(VECTOR_BENCH_SIZE * 5));
+
+	LOG("");
+	CASE("Vector - vector<bool> bitmaps (" << BITMAP_BENCH_SIZE << " bits, 1 in 64 set)");
+	{
+		ft::vector<bool>		bits = vector_bench_bitmap(BITMAP_BENCH_SIZE, 64);
+		const ft::vector<bool>	mask = vector_bench_bitmap(BITMAP_BENCH_SIZE, 2);
+
+		BENCH_COUNT("vector<bool> storage (KiB)", bits.capacity() / 8 / 1024);
+		BENCH("vector<bool> count, bit by bit", vector_bench_bitmap_count_bits(bits));
+		BENCH("vector<bool> set bits, bit by bit", vector_bench_bitmap_scan_bits(bits));
+#if !defined(STL)
+		BENCH("vector<bool>::count", vector_bench_bitmap_count(bits));
+		BENCH("vector<bool> set bits, find_next", vector_bench_bitmap_scan(bits));
+		BENCH("vector<bool> &=", vector_bench_bitmap_and(bits, mask));
+#endif
+		BENCH("vector<bool> and, bit by bit", vector_bench_bitmap_and_bits(bits, mask));
+	}
+}
@@ -0,0 +1,254 @@
+#include "convert.hpp"
+#include "tests/deque_tests.hpp"
+
+void	deque_test_constructor( void ) {
+	CASE("Constructor - default, fill, range, copy");
+
+	Deque_t		words[4] = {"foo", "bar", "bazz", "buzz"};
+	Deque		d;
+	Deque		fill(3, "abc");
+	Deque		range(words, words + 4);
+	Deque		copy(range);
+
+	LOG(SPEC(d.size() == 0) << "Size is 0");
+	LOG(SPEC(d.empty()) << "Is empty");
+	print_deque(fill);
+	print_deque(range);
+	print_deque(copy);
+
+	d = copy; // test assignment replaces the elements
+	print_deque(d);
+	LOG(SPEC(d == range) << "d == range");
+	LOG("");
+}
+
+void	deque_test_push_pop( void ) {
+	CASE("Push / pop - both ends");
+
+	DequeInt	d;
+
+	// enough to cross several blocks at both ends
+	for (int i = 0; i < 1000; i++) {
+		d.push_back(i);
+		d.push_front(-i);
+	}
+	print_metrics_deque(d);
+	LOG("front: " << d.front() << ", back: " << d.back());
+	LOG("d[0]: " << d[0] << ", d[999]: " << d[999] << ", d[1000]: " << d[1000]);
+
+	for (int i = 0; i < 700; i++) {
+		d.pop_front();
+	}
+	for (int i = 0; i < 900; i++) {
+		d.pop_back();
+	}
+	print_metrics_deque(d);
+	LOG("front: " << d.front() << ", back: " << d.back());
+	print_deque(d);
+
+	while (!d.empty()) {
+		d.pop_back();
+	}
+	d.push_front(42);
+	print_deque(d);
+	LOG("");
+}
+
+void	deque_test_insert( void ) {
+	CASE("Insert - single, fill, range");
+
+	Deque		d(2, "000");
+	Deque_t		words[4] = {"foo", "bar", "bazz", "buzz"};
+
+	LOG(">> insert at: 1, 100");
+	Deque_it	it = d.insert(d.begin() + 1, "100");
+	LOG(SPEC(*it == "100") << "returns the inserted element");
+	print_deque(d);
+
+	LOG(">> insert at: 1, 3x 300");
+	d.insert(d.begin() + 1, 3, "300");
+	print_deque(d);
+
+	LOG(">> insert at: end - 1, words");
+	d.insert(d.end() - 1, words, words + 4);
+	print_deque(d);
+
+	LOG(">> insert at: begin, 200x 200");
+	d.insert(d.begin(), 200, "200");
+	print_metrics_deque(d);
+	LOG("d[199]: " << d[199] << ", d[200]: " << d[200]);
+
+	LOG(">> insert at: end, 200x 400");
+	d.insert(d.end(), 200, "400");
+	print_metrics_deque(d);
+	LOG("d[209]: " << d[209] << ", back: " << d.back());
+	LOG("");
+}
+
+void	deque_test_erase( void ) {
+	CASE("Erase - single, range");
+
+	DequeInt	d;
+
+	for (int i = 0; i < 600; i++) {
+		d.push_back(i);
+	}
+
+	LOG(">> erase at: 1");
+	DequeInt::iterator	it = d.erase(d.begin() + 1);
+	LOG(SPEC(*it == 2) << "returns the next element");
+
+	LOG(">> erase at: end - 2");
+	it = d.erase(d.end() - 2);
+	LOG(SPEC(*it == 599) << "returns the next element");
+	print_metrics_deque(d);
+
+	LOG(">> erase: [10, 300)");
+	it = d.erase(d.begin() + 10, d.begin() + 300);
+	LOG("next: " << *it);
+	print_metrics_deque(d);
+
+	LOG(">> erase: [200, end)");
+	it = d.erase(d.begin() + 200, d.end());
+	LOG(SPEC(it == d.end()) << "returns end");
+	print_metrics_deque(d);
+	print_deque(d);
+	LOG("");
+}
+
+void	deque_test_resize_assign( void ) {
+	CASE("Resize / assign / clear");
+
+	Deque		d(4, "foo");
+	Deque_t		words[4] = {"foo", "bar", "bazz", "buzz"};
+
+	d.resize(6, "bar");
+	print_deque(d);
+	d.resize(2);
+	print_deque(d);
+	d.assign(5, "bazz");
+	print_deque(d);
+	d.assign(words, words + 3);
+	print_deque(d);
+	d.clear();
+	print_metrics_deque(d);
+	d.push_back("buzz");
+	print_deque(d);
+	LOG("");
+}
+
+void	deque_test_iterators( void ) {
+	CASE("Iterators");
+
+	DequeInt	d;
+
+	for (int i = 0; i < 300; i++) {
+		d.push_front(i);
+	}
+
+	const DequeInt &			cd = d;
+	DequeInt::const_iterator	cit = cd.begin() + 150;
+	DequeInt::iterator			it = d.begin();
+
+	it += 250;
+	LOG("*it: " << *it << ", it[-100]: " << it[-100] << ", *cit: " << *cit);
+	LOG(SPEC(it - cit == 100) << "it - cit == 100");
+	LOG(SPEC(cit < it && it > cit) << "cit < it");
+
+	long	sum = 0;
+	for (DequeInt::reverse_iterator rit = d.rbegin(); rit != d.rend(); ++rit) {
+		sum += *rit;
+	}
+	LOG("sum: " << sum);
+	LOG("");
+}
+
+void	deque_test_at( void ) {
+	CASE("At");
+
+	Deque	d(3, "foo");
+
+	d.at(2) = "bar";
+	print_deque(d);
+	try {
+		d.at(3);
+		LOG(SPEC(false) << "at(3) throws");
+	} catch (std::out_of_range &) {
+		LOG(SPEC(true) << "at(3) throws");
+	}
+	LOG("");
+}
+
+void	deque_test_relational( void ) {
+	CASE("Relational operators");
+
+	Deque_t		words[4] = {"foo", "bar", "bazz", "buzz"};
+	Deque		a(words, words + 4);
+	Deque		b(words, words + 3);
+
+	LOG(SPEC(a != b) << "a != b");
+	LOG(SPEC(b < a) << "b < a");
+	LOG(SPEC(a >= b) << "a >= b");
+	b.push_back("buzz");
+	LOG(SPEC(a == b) << "a == b");
+
+	b.swap(a);
+	ft::swap(a, b);
+	LOG(SPEC(a <= b) << "a <= b");
+	LOG("");
+}
+
+// Deques that never held an element, then a vector of them growing
+void	deque_test_empty( void ) {
+	CASE("Empty - before the first element");
+
+	Deque	d;
+	Deque	copy(d);
+	Deque	fill(0, Deque_t("abc"));
+
+	print_metrics_deque(d);
+	LOG(SPEC(d.begin() == d.end()) << "begin() == end()");
+	LOG(SPEC(copy == d && fill == d && !(d < copy)) << "empty deques compare equal");
+	d.clear();
+	d.resize(0);
+	d.erase(d.begin(), d.end());
+#if defined(STL)
+	d.erase(std::remove(d.begin(), d.end(), "abc"), d.end());
+#else
+	ft::erase(d, "abc");
+#endif
+	print_metrics_deque(d);
+
+	copy.push_front("front");
+	fill.insert(fill.begin(), 2, "two");
+	d.swap(copy);
+	print_deque(d);
+	print_deque(copy);
+	print_deque(fill);
+
+	ft::vector<Deque>	rows;
+
+	for (size_t i = 0; i < 20; i++) {
+		rows.push_back(Deque());
+		rows.back().push_back(to_s(i));
+	}
+	rows.insert(rows.begin(), Deque(3, Deque_t("x")));
+	print_deque(rows[0]);
+	print_deque(rows[20]);
+	LOG("");
+}
+
+void	deque_tests( void ) {
+	LOG("");
+	LOG(COLOR_LPURPLE("➤ Deque Tests"));
+	LOG("");
+    deque_test_constructor();
+    deque_test_push_pop();
+    deque_test_insert();
+    deque_test_erase();
+    deque_test_resize_assign();
+    deque_test_iterators();
+    deque_test_at();
+    deque_test_relational();
+    deque_test_empty();
+}
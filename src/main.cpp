@@ -5,20 +5,24 @@
 #include "convert.hpp"
 #include "tests/vector_tests.hpp"
 #include "tests/stack_tests.hpp"
+#include "tests/deque_tests.hpp"
 #include "tests/map_tests.hpp"
 #include "tests/set_tests.hpp"
+#include "tests/algorithm_tests.hpp"
 
 # define VECTOR  "vector"
 # define STACK   "stack"
+# define DEQUE   "deque"
 # define MAP     "map"
 # define SET     "set"
+# define ALGORITHM "algorithm"
 
 typedef std::map<String, bool>	Tests;
 
 int	print_usage(char *name) {
     ERROR("Usage: " << name << " [cycles = 1] [containers = all]");
     ERROR("  cycles:      number of test runs");
-    ERROR("  containers:  " << VECTOR << " / " << STACK << " / " << MAP << " / " << SET);
+    ERROR("  containers:  " << VECTOR << " / " << STACK << " / " << DEQUE << " / " << MAP << " / " << SET << " / " << ALGORITHM);
 	return 1;
 }
 
@@ -33,8 +37,10 @@ int	main( int argc, char **argv ) {
 
 	tests[VECTOR]	= false;
 	tests[STACK] 	= false;
+	tests[DEQUE] 	= false;
 	tests[MAP] 		= false;
 	tests[SET] 		= false;
+	tests[ALGORITHM]	= false;
 
 	// cycles
 	int cycles = argc > 1 ? to_i(argv[1]) : 1;
@@ -56,8 +62,10 @@ int	main( int argc, char **argv ) {
 	} else {
 		tests[VECTOR]	= true;
 		tests[STACK] 	= true;
+		tests[DEQUE] 	= true;
 		tests[MAP] 		= true;
 		tests[SET] 		= true;
+		tests[ALGORITHM]	= true;
 	}
 
 	// timer
@@ -65,8 +73,10 @@ int	main( int argc, char **argv ) {
     for (int i = 0; i < cycles; i++) {
         if (tests[VECTOR])	vector_tests();
         if (tests[STACK])	stack_tests();
+        if (tests[DEQUE])	deque_tests();
         if (tests[MAP])		map_tests();
         if (tests[SET])		set_tests();
+        if (tests[ALGORITHM])	algorithm_tests();
     }
     clock_t	end_time = clock();
 
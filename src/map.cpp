@@ -110,6 +110,58 @@ void	map_test_riterator( void ) {
 	LOG("");
 }
 
+void	map_test_iterator_steps( void ) {
+	CASE("Iterators - stepping both ways");
+
+	Map				m;
+	unsigned long	seed = 1;
+
+	for (int i = 0; i < 500; i++) {
+		seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+		m[to_s(seed >> 40)] = to_s(i);
+	}
+	int	n = 0;
+
+	for (Map_it it = m.begin(); it != m.end(); n++) {
+		if (n % 3 == 0) {
+			m.erase(it++);
+		} else {
+			++it;
+		}
+	}
+
+	size_t	forward = 0;
+	bool	sorted = true;
+
+	for (Map_it it = m.begin(); it != m.end(); ++it, ++forward) {
+		Map_it	next = it;
+
+		if (++next != m.end() && !(it->first < next->first)) {
+			sorted = false;
+		}
+	}
+
+	size_t	backward = 0;
+	bool	round_trip = true;
+
+	for (Map_it it = m.end(); it != m.begin(); ++backward) {
+		Map_it	after = it;
+		Map_it	back = --it;
+
+		if (++back != after) {
+			round_trip = false;
+		}
+	}
+
+	print_metrics_map(m);
+	LOG(SPEC(forward == m.size()) << "forward == m.size()");
+	LOG(SPEC(backward == m.size()) << "backward == m.size()");
+	LOG(SPEC(sorted) << "sorted");
+	LOG(SPEC(round_trip) << "round_trip");
+	LOG(SPEC(--m.end() == --Map_it(m.rbegin().base())) << "--m.end() == --m.rbegin().base()");
+	LOG("");
+}
+
 void	map_test_const_iterator( void ) {
 	CASE("Iterators - const");
 
@@ -375,6 +427,30 @@ void	map_test_insert_single( void ) {
 	LOG("");
 }
 
+void	map_test_insert_duplicate( void ) {
+	CASE("Insert - duplicates");
+
+	Map	m;
+
+	m[k_bbb] = v_bbb;
+	m[k_ddd] = v_ddd;
+	m[k_aaa] = v_aaa;
+
+	// the existing value is kept
+	ft::pair<Map_it, bool>	result = m.insert(Pair(k_ddd, v_fff));
+	Map_it					m_it = m.insert(m.end(), Pair(k_aaa, v_fff));
+
+	print_map(m);
+	print_metrics_map(m);
+
+	LOG(SPEC(result.first->second == v_ddd) << "result.first->second == v_ddd");
+	LOG(SPEC(result.second == false) << "result.second == false");
+	LOG(SPEC(m_it == m.begin()) << "m_it == m.begin()");
+	LOG(SPEC(m_it->second == v_aaa) << "m_it->second == v_aaa");
+
+	LOG("");
+}
+
 void	map_test_clear( void ) {
 	CASE("Clear");
 
@@ -522,6 +598,46 @@ void	map_test_inequality_comparisons( void ) {
 	LOG("");
 }
 
+void	map_test_pool_allocator( void ) {
+	CASE("Pool allocator");
+
+	PoolMap	m;
+
+	for (int i = 0; i < 1000; i++) {
+		m[to_s(i)] = to_s(i * 2);
+	}
+	for (int i = 0; i < 1000; i += 2) {
+		m.erase(to_s(i));
+	}
+	// reuses the erased nodes
+	for (int i = 0; i < 1000; i += 4) {
+		m.insert(PoolMap::value_type(to_s(i), "again"));
+	}
+	print_metrics_map(m);
+	LOG(SPEC(m["0"] == "again") << "m[\"0\"] == again");
+	LOG(SPEC(m["1"] == "2") << "m[\"1\"] == 2");
+	LOG(SPEC(m.count("2") == 0) << "m.count(\"2\") == 0");
+
+	PoolMap	copy(m);
+	PoolMap	other;
+
+	other["k"] = "v";
+	copy.swap(other);
+	print_map(copy);
+	print_metrics_map(other);
+	LOG(SPEC(other == m) << "other == m");
+
+	m.clear();
+	print_metrics_map(m);
+	LOG(SPEC(m.begin() == m.end()) << "m.begin() == m.end()");
+	m[k_aaa] = v_aaa;
+	m[k_bbb] = v_bbb;
+	print_map(m);
+	LOG(SPEC(other.size() == 750) << "other.size() == 750");
+
+	LOG("");
+}
+
 void	map_tests( void ) {
 	LOG("");
 	LOG(COLOR_LPURPLE("➤ Map Tests"));
@@ -531,6 +647,7 @@ void	map_tests( void ) {
     map_test_constructor_range();
     map_test_iterator();
     map_test_riterator();
+    map_test_iterator_steps();
     map_test_const_iterator();
     map_test_empty();
     map_test_max_size();
@@ -541,6 +658,7 @@ void	map_tests( void ) {
     map_test_swap();
     map_test_insert_range();
     map_test_insert_single();
+    map_test_insert_duplicate();
     map_test_clear();
     map_test_get_allocator();
     map_test_count();
@@ -548,4 +666,5 @@ void	map_tests( void ) {
     map_test_equality();
     map_test_inequality();
     map_test_inequality_comparisons();
+    map_test_pool_allocator();
 }
@@ -301,6 +301,28 @@ void	set_test_insert_single( void ) {
 	LOG("");
 }
 
+void	set_test_insert_duplicate( void ) {
+	CASE("Insert - duplicates");
+
+	Set	s;
+
+	s.insert(s_bbb);
+	s.insert(s_ddd);
+	s.insert(s_aaa);
+
+	ft::pair<Set_it, bool>	result = s.insert(s_ddd);
+	Set_it					s_it = s.insert(s.end(), s_aaa);
+
+	print_set(s);
+	print_metrics_set(s);
+
+	LOG(SPEC(*result.first == s_ddd) << "*result.first == s_ddd");
+	LOG(SPEC(result.second == false) << "result.second == false");
+	LOG(SPEC(s_it == s.begin()) << "s_it == s.begin()");
+
+	LOG("");
+}
+
 void	set_test_clear( void ) {
 	CASE("Clear");
 
@@ -450,6 +472,29 @@ void	set_test_inequality_comparisons( void ) {
 	LOG("");
 }
 
+void	set_test_no_default_constructor( void ) {
+	CASE("Key without default constructor");
+
+	ft::set<Version>	s;
+	ft::set<Version>	empty(s);
+
+	s.insert(Version(1, 2));
+	s.insert(Version(0, 9));
+	s.insert(Version(1, 10));
+	s.insert(Version(1, 2));
+	print_set(s);
+	print_metrics_set(s);
+
+	s.erase(Version(0, 9));
+	s.swap(empty);
+	print_set(s);
+	print_set(empty);
+	LOG(SPEC(s.begin() == s.end()) << "s.begin() == s.end()");
+	LOG(SPEC(empty.rbegin()->minor == 10) << "empty.rbegin()->minor == 10");
+
+	LOG("");
+}
+
 void	set_tests( void ) {
 	LOG("");
 	LOG(COLOR_LPURPLE("➤ Set Tests"));
@@ -467,6 +512,7 @@ void	set_tests( void ) {
     set_test_swap();
     set_test_insert_range();
     set_test_insert_single();
+    set_test_insert_duplicate();
     set_test_clear();
     set_test_get_allocator();
     set_test_count();
@@ -474,4 +520,5 @@ void	set_tests( void ) {
     set_test_equality();
     set_test_inequality();
     set_test_inequality_comparisons();
+    set_test_no_default_constructor();
 }
@@ -43,4 +43,18 @@ void	stack_tests( void ) {
     stack_test_equality<StackList>();
     stack_test_inequality<StackList>();
     stack_test_inequality_comparisons<StackList>();
+	LOG("");
+	LOG(COLOR_LPURPLE("➤ Stack (small_vector) Tests"));
+	LOG("");
+    stack_test_constructor<StackSmallVector>();
+    stack_test_constructor_copy<StackSmallVector>();
+    stack_test_constructor_assignment<StackSmallVector>();
+    stack_test_constructor_container<StackSmallVector>();
+    stack_test_empty<StackSmallVector>();
+    stack_test_top<StackSmallVector>();
+    stack_test_pop<StackSmallVector>();
+    stack_test_push<StackSmallVector>();
+    stack_test_equality<StackSmallVector>();
+    stack_test_inequality<StackSmallVector>();
+    stack_test_inequality_comparisons<StackSmallVector>();
 }
@@ -1,3 +1,4 @@
+#include "convert.hpp"
 #include "tests/vector_tests.hpp"
 
 void	vector_test_constructor( void ) {
@@ -44,6 +45,32 @@ void	vector_test_constructor_range( void ) {
 	LOG("");
 }
 
+void	vector_test_constructor_range_input( void ) {
+	CASE("Constructor - range (input iterator)");
+
+	std::istringstream					in("foo bar bazz buzz");
+	std::istream_iterator<Vector_t>		first(in);
+	std::istream_iterator<Vector_t>		last;
+	Vector								v(first, last);
+
+	print_vector(v);
+
+	LOG(SPEC(v.size() == 4) << "Size is 4");
+
+	std::istringstream					more("100 200");
+
+	v.insert(v.begin() + 1, std::istream_iterator<Vector_t>(more), last);
+	print_vector(v);
+
+	std::istringstream					other("300");
+
+	v.assign(std::istream_iterator<Vector_t>(other), last);
+	print_vector(v);
+
+	LOG(SPEC(v.size() == 1) << "Size is 1");
+	LOG("");
+}
+
 void	vector_test_constructor_fill( void ) {
 	CASE("Constructor - fill");
 
@@ -200,6 +227,61 @@ void	vector_test_reserve( void ) {
 	LOG("");
 }
 
+void	vector_test_shrink_to_fit( void ) {
+	CASE("Shrink to fit");
+
+	Vector_t	words[4] = {"foo", "bar", "bazz", "buzz"};
+	Vector		v(words, words + 4);
+
+	v.reserve(100);
+	v.pop_back();
+#if defined(STL)
+	Vector(v).swap(v); // C++98 has no shrink_to_fit
+#else
+	v.shrink_to_fit();
+#endif
+
+	print_vector(v);
+	print_metrics_vector(v);
+
+#if defined(STL)
+	Vector().swap(v);
+#else
+	v.release();
+#endif
+
+	print_metrics_vector(v);
+
+	LOG("");
+}
+
+void	vector_test_reserve_reallocate( void ) {
+	CASE("Reserve (reallocating allocator)");
+
+#if defined(STL)
+	typedef ft::vector<int>									IntVector;
+#else
+	typedef ft::vector< int, ft::mmap_allocator<int> >		IntVector;
+#endif
+	IntVector	v;
+
+	for (int i = 0; i < 1000; i++) {
+		v.push_back(i);
+	}
+	print_metrics_vector(v);
+
+	v.reserve(100000);
+	v.insert(v.begin() + 500, 200000, 42);
+	v.push_back(v.front());
+
+	print_vector(v);
+	print_metrics_vector(v);
+	LOG(SPEC(v[499] == 499 && v[500] == 42 && v[200500] == 500) << "Elements kept their order");
+	LOG(SPEC(v.back() == 0) << "v.back() == 0");
+
+	LOG("");
+}
+
 void	vector_test_at( void ) {
 	CASE("At");
 
@@ -323,6 +405,40 @@ void	vector_test_erase_range( void ) {
 	LOG("");
 }
 
+struct IsShort {
+	bool	operator () ( const Vector_t & s ) const { return s.size() < 4; }
+};
+
+// ft::erase / ft::erase_if, the erase-remove idiom in std (C++20 before that)
+void	vector_test_erase_if( void ) {
+	CASE("Erase - erase / erase_if");
+
+	Vector_t	words[7] = {"foo", "bar", "bazz", "foo", "buzz", "qux", "foo"};
+	Vector		v(words, words + 7);
+	size_t		n;
+
+#if defined(STL)
+	n = v.end() - std::remove(v.begin(), v.end(), "foo");
+	v.erase(v.end() - n, v.end());
+#else
+	n = ft::erase(v, "foo");
+#endif
+	LOG("erased: " << n);
+	print_vector(v);
+	print_metrics_vector(v);
+
+#if defined(STL)
+	n = v.end() - std::remove_if(v.begin(), v.end(), IsShort());
+	v.erase(v.end() - n, v.end());
+#else
+	n = ft::erase_if(v, IsShort());
+#endif
+	LOG("erased: " << n);
+	print_vector(v);
+	print_metrics_vector(v);
+	LOG("");
+}
+
 void	vector_test_pop_back( void ) {
 	CASE("Pop back");
 
@@ -612,6 +728,592 @@ void	vector_test_inequality_comparisons( void ) {
 	LOG("");
 }
 
+void	vector_test_soa_modifiers( void ) {
+	CASE("soa_vector - modifiers");
+
+	SoaVector	v;
+
+	v.push_back(Row(3, "c"));
+	v.push_back(Row(1, "a"));
+	v.push_back(Row(2, "b"));
+	print_rows(v);
+	v.insert(v.begin() + 1, Row(7, "g"));
+	v.insert(v.end(), 2, Row(0, "z"));
+	print_rows(v);
+	v.erase(v.begin(), v.begin() + 2);
+	v.pop_back();
+	print_rows(v);
+	LOG("Size: " << v.size());
+	LOG("front: " << v.front().first << ":" << v.front().second << ", back: " << v.back().first << ":" << v.back().second);
+
+	v[0].second = "B";
+	v.begin()->first = 20;
+	(v.end() - 1)->second = "Z";
+	print_rows(v);
+
+	Row			rows[3] = {Row(4, "d"), Row(5, "e"), Row(6, "f")};
+	std::list<Row>	more(rows, rows + 3);
+
+	v.insert(v.begin() + 1, rows, rows + 3);
+	v.insert(v.end(), more.begin(), more.end());
+	v.insert(v.begin(), more.rbegin(), more.rend());
+	print_rows(v);
+	v.erase(v.begin() + 3, v.end() - 2);
+	print_rows(v);
+
+	SoaVector	copy(v.rbegin(), v.rend());
+
+	print_rows(copy);
+	LOG(SPEC(copy != v) << "copy != v");
+	copy.assign(v.begin(), v.end());
+	LOG(SPEC(copy == v) << "copy == v");
+	LOG(SPEC(!(copy < v)) << "!(copy < v)");
+
+	try {
+		v.at(10);
+	} catch (std::out_of_range & e) {
+		LOG(SPEC(true) << "at(10) throws out_of_range");
+	}
+
+	LOG("");
+}
+
+void	vector_test_soa_sort( void ) {
+	CASE("soa_vector - sort");
+
+	const char *	names[8] = {"pear", "fig", "kiwi", "apple", "lime", "fig", "plum", "yam"};
+	const int		keys[8] = {4, 2, 4, 1, 3, 2, 0, 1};
+	SoaVector		v;
+
+	for (int i = 0; i < 8; i++) {
+		v.push_back(Row(keys[i], names[i]));
+	}
+	ft::sort(v.begin(), v.end());
+	print_rows(v);
+
+	ft::sort(v.rbegin(), v.rend());
+	print_rows(v);
+
+	long	sum = 0;
+#if defined(STL)
+	for (size_t i = 0; i < v.size(); i++) {
+		sum += v[i].first;
+	}
+#else
+	const int *	column = v.keys();
+
+	for (size_t i = 0; i < v.size(); i++) {
+		sum += column[i];
+	}
+#endif
+	LOG("sum of the keys: " << sum);
+	LOG("");
+}
+
+void	vector_test_bool_modifiers( void ) {
+	CASE("vector<bool> - modifiers");
+
+	BoolVector	v;
+
+	for (int i = 0; i < 70; i++) {
+		v.push_back(i % 3 == 0);
+	}
+	print_bits(v);
+	v.insert(v.begin() + 1, 5, true);
+	v.insert(v.begin() + 64, false);
+	print_bits(v);
+	v.erase(v.begin() + 2, v.begin() + 40);
+	v.erase(v.end() - 1);
+	v.pop_back();
+	print_bits(v);
+
+	v[0] = false;
+	v[1].flip();
+	v.back() = v.front();
+	BoolVector::swap(v[2], v[3]);
+	*(v.begin() + 4) = true;
+	print_bits(v);
+	LOG("front: " << v.front() << ", back: " << v.back());
+
+	v.resize(100, true);
+	v.flip();
+	print_bits(v);
+	v.resize(10);
+	print_bits(v);
+
+	BoolVector	copy(v.rbegin(), v.rend());
+
+	print_bits(copy);
+	LOG(SPEC(copy != v) << "copy != v");
+	copy.assign(v.begin(), v.end());
+	LOG(SPEC(copy == v) << "copy == v");
+	copy.assign(3, true);
+	print_bits(copy);
+
+	try {
+		v.at(10);
+	} catch (std::out_of_range & e) {
+		LOG(SPEC(true) << "at(10) throws out_of_range");
+	}
+
+	BoolVector	one(1, true);
+
+	one.pop_back();
+#if !defined(STL)
+	one.pop_back(); // empty: no-op, undefined in std
+#endif
+	LOG(SPEC(one.empty()) << "pop_back empties, then does nothing");
+	one.push_back(true);
+	print_bits(one);
+	LOG("");
+}
+
+// count / find_first / find_next and the bitwise operators, element wise in std
+void	vector_test_bool_bit_operations( void ) {
+	CASE("vector<bool> - bit operations");
+
+	unsigned int	seed = 5;
+	BoolVector		a(300);
+	BoolVector		b(300);
+
+	for (size_t i = 0; i < a.size(); i++) {
+		seed = seed * 1103515245 + 12345; // same bits on every platform, unlike rand()
+		a[i] = (seed >> 8) % 5 == 0;
+		b[i] = (seed >> 12) % 2 == 0;
+	}
+
+#if defined(STL)
+	size_t	count = std::count(a.begin(), a.end(), true);
+#else
+	size_t	count = a.count();
+#endif
+	LOG("count: " << count);
+
+	COUT("set:");
+#if defined(STL)
+	for (size_t i = 0; i < a.size(); i++) {
+		if (a[i]) {
+			COUT(" " << i);
+		}
+	}
+#else
+	for (size_t i = a.find_first(); i != BoolVector::npos; i = a.find_next(i)) {
+		COUT(" " << i);
+	}
+#endif
+	LOG("");
+
+	BoolVector	x(a);
+	BoolVector	y(a);
+	BoolVector	z(a);
+
+#if defined(STL)
+	for (size_t i = 0; i < a.size(); i++) {
+		x[i] = a[i] && b[i];
+		y[i] = a[i] || b[i];
+		z[i] = a[i] != b[i];
+	}
+#else
+	x &= b;
+	y |= b;
+	z = z ^ b;
+#endif
+	print_bits(x);
+	print_bits(y);
+	print_bits(z);
+	LOG("");
+}
+
+// Back under SMALL_N: ft moves the elements inline, std gets the capacity ft has there
+template <typename T>
+void	small_shrink_to_fit( T & v ) {
+#if defined(STL)
+	T(v).swap(v);
+	v.reserve(SMALL_N);
+#else
+	v.shrink_to_fit();
+#endif
+}
+
+void	vector_test_small_boundary( void ) {
+	CASE("small_vector - crossing the inline capacity");
+
+	Vector_t	words[8] = {"a", "b", "c", "d", "e", "f", "g", "h"};
+	SmallVector	v;
+
+#if defined(STL)
+	v.reserve(SMALL_N);
+#endif
+	for (size_t i = 0; i < 8; i++) {
+		v.push_back(words[i]);
+		if (i == SMALL_N - 1 || i == SMALL_N) {
+			print_small(v);
+		}
+	}
+	v.erase(v.begin() + 1, v.begin() + 6);
+	print_small(v);
+	small_shrink_to_fit(v);
+	print_small(v);
+
+	v.insert(v.begin() + 1, "x");
+	print_small(v);
+	v.insert(v.begin() + 2, 2, "y");
+	print_small(v);
+	v.erase(v.begin());
+	print_small(v);
+	small_shrink_to_fit(v);
+	print_small(v);
+	v.insert(v.end() - 1, words, words + 3);
+	print_small(v);
+	v.pop_back();
+	v.resize(2);
+	small_shrink_to_fit(v);
+	print_small(v);
+
+	v.clear();
+	print_small(v);
+	v.resize(6, "z");
+	print_small(v);
+	v.clear();
+	small_shrink_to_fit(v);
+	print_small(v);
+	LOG("");
+}
+
+void	vector_test_small_swap_copy( void ) {
+	CASE("small_vector - swap, copy and assignment");
+
+	Vector_t	words[8] = {"a", "b", "c", "d", "e", "f", "g", "h"};
+	SmallVector	small(words, words + 2);
+	SmallVector	big(words, words + 8);
+	Vector_t *	block = &big[0];
+
+	small.swap(big);
+	print_small(small);
+	print_small(big);
+	LOG(SPEC(&small[0] == block) << "the heap block changes hands");
+	ft::swap(small, big);
+	print_small(small);
+	print_small(big);
+	LOG(SPEC(&big[0] == block) << "and comes back");
+
+	SmallVector	one(words + 5, words + 6);
+	SmallVector	three(words + 1, words + 4);
+
+	one.swap(three);
+	print_small(one);
+	print_small(three);
+	one.swap(one);
+	print_small(one);
+
+	SmallVector	from_heap(big);
+	SmallVector	from_inline(small);
+
+	print_small(from_heap);
+	print_small(from_inline);
+
+	from_inline = big;
+	print_small(from_inline);
+	from_heap = three;
+	print_small(from_heap);
+	LOG(SPEC(from_inline == big) << "copies compare equal");
+	LOG("");
+}
+
+// Bytes in the file at path, -1 if it can't be read
+long	file_length( const std::string & path ) {
+	struct stat	st;
+
+	return ::stat(path.c_str(), &st) < 0 ? -1 : static_cast<long>(st.st_size);
+}
+
+template <typename T>
+bool	is_multiples_of_3( const T & v ) {
+	for (size_t i = 0; i < v.size(); i++) {
+		if (v[i] != static_cast<int>(i) * 3) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/*
+**	mapped_vector keeps its elements in the file, std writes and reads them
+**	back with streams: both leave the same bytes behind.
+*/
+void	vector_test_mapped( void ) {
+	CASE("mapped_vector - file backed");
+
+	std::string	path("/tmp/containers_mapped_" + to_s(::getpid()) + ".bin");
+
+	std::remove(path.c_str());
+	{
+#if defined(STL)
+		std::vector<int>	v;
+#else
+		ft::mapped_vector<int>	v(path);
+#endif
+		for (int i = 0; i < 3000; i++) { // several pages, several remaps
+			v.push_back(i * 3);
+		}
+		LOG("written: " << v.size() << ", back: " << v.back());
+		LOG(SPEC(is_multiples_of_3(v)) << "growth keeps the contents");
+#if defined(STL)
+		std::ofstream	out(path.c_str(), std::ios::binary);
+
+		out.write(reinterpret_cast<const char *>(&v[0]), v.size() * sizeof(int));
+#endif
+	}
+	LOG("file length: " << file_length(path));
+
+	{
+#if defined(STL)
+		std::vector<int>	v(file_length(path) / sizeof(int));
+		std::ifstream		in(path.c_str(), std::ios::binary);
+
+		in.read(reinterpret_cast<char *>(&v[0]), v.size() * sizeof(int));
+#else
+		ft::mapped_vector<int>	v(path);
+#endif
+		LOG("reopened: " << v.size() << ", front: " << v.front() << ", back: " << v.back());
+		LOG(SPEC(is_multiples_of_3(v)) << "contents survive closing");
+		v.resize(1000);
+		v.push_back(3000);
+#if defined(STL)
+		std::ofstream	out(path.c_str(), std::ios::binary | std::ios::trunc);
+
+		out.write(reinterpret_cast<const char *>(&v[0]), v.size() * sizeof(int));
+#endif
+	}
+	LOG("file length: " << file_length(path));
+
+	{
+#if defined(STL)
+		std::vector<int>	v(file_length(path) / sizeof(int));
+		std::ifstream		in(path.c_str(), std::ios::binary);
+
+		in.read(reinterpret_cast<char *>(&v[0]), v.size() * sizeof(int));
+		LOG(SPEC(true) << "read only rejects push_back, resize and clear");
+#else
+		ft::mapped_vector<int>	v(path, ft::mapped_vector<int>::read_only);
+		int						rejected = 0;
+
+		try { v.push_back(1); } catch (std::logic_error &) { rejected++; }
+		try { v.resize(0); } catch (std::logic_error &) { rejected++; }
+		try { v.clear(); } catch (std::logic_error &) { rejected++; }
+		LOG(SPEC(rejected == 3) << "read only rejects push_back, resize and clear");
+#endif
+		LOG("read only: " << v.size() << ", back: " << v.back());
+		LOG(SPEC(is_multiples_of_3(v)) << "maps the existing length");
+	}
+	LOG("file length: " << file_length(path));
+
+	std::remove(path.c_str());
+	LOG("");
+}
+
+void	vector_test_aligned( void ) {
+	CASE("aligned_allocator - data() alignment");
+
+	AlignedVector	v(5, 1.5f);
+
+	LOG(SPEC(is_aligned(v)) << "after construction (" << v.size() << ")");
+	for (int i = 0; i < 1000; i++) {
+		v.push_back(static_cast<float>(i));
+	}
+	LOG(SPEC(is_aligned(v)) << "after growth (" << v.size() << ")");
+#if defined(STL)
+	v.reserve(3000);
+#else
+	v.reserve_exact(3000);
+#endif
+	LOG(SPEC(is_aligned(v)) << "after reserve_exact (" << v.size() << ")");
+	v.resize(17);
+#if defined(STL)
+	AlignedVector(v).swap(v);
+#else
+	v.shrink_to_fit();
+#endif
+	LOG(SPEC(is_aligned(v)) << "after shrink_to_fit (" << v.size() << ")");
+
+	AlignedVector	copy(v);
+
+	LOG(SPEC(is_aligned(copy)) << "copy (" << copy.size() << ")");
+	LOG("front: " << copy.front() << ", back: " << copy.back());
+	LOG("");
+}
+
+/*
+**	The capacities push_back goes through until it holds n elements. std has
+**	no growth policies: its side prints what each policy promises.
+*/
+#if defined(STL)
+size_t	next_factor( size_t capacity, size_t value_size, size_t num, size_t den ) {
+	(void)value_size;
+	return capacity + std::max<size_t>(capacity * (num - den) / den, 1);
+}
+
+size_t	next_page( size_t capacity, size_t value_size, size_t num, size_t den ) {
+	size_t	doubled = next_factor(capacity, value_size, num, den);
+	size_t	page = 4096;
+
+	if (doubled * value_size < page) {
+		return doubled;
+	}
+	return (doubled * value_size + page - 1) / page * page / value_size; // whole elements in whole pages
+}
+
+void	print_growth( const char * name, size_t n, size_t value_size, size_t num, size_t den,
+					  size_t (*next)( size_t, size_t, size_t, size_t ) ) {
+	COUT(name << ":");
+	for (size_t capacity = 0; capacity < n;) {
+		capacity = next(capacity, value_size, num, den);
+		COUT(" " << capacity);
+	}
+	LOG("");
+}
+#else
+template <typename V>
+void	print_growth( const char * name, size_t n ) {
+	V		v;
+	size_t	capacity = v.capacity();
+
+	COUT(name << ":");
+	for (size_t i = 0; i < n; i++) {
+		v.push_back(typename V::value_type());
+		if (v.capacity() != capacity) {
+			capacity = v.capacity();
+			COUT(" " << capacity);
+		}
+	}
+	LOG("");
+}
+#endif
+
+void	vector_test_growth( void ) {
+	CASE("Growth policies - capacity sequence");
+
+#if defined(STL)
+	print_growth("2x", 5000, sizeof(int), 2, 1, next_factor);
+	print_growth("1.5x", 5000, sizeof(int), 3, 2, next_factor);
+	print_growth("4 KiB pages", 5000, sizeof(int), 2, 1, next_page);
+	print_growth("4 KiB pages, 12 byte elements", 5000, sizeof(Rgb), 2, 1, next_page);
+	LOG("2x clamped: 100");
+	LOG("1.5x clamped: 100");
+	LOG("4 KiB pages clamped: 1500");
+	LOG(SPEC(true) << "4 KiB pages at max_size");
+#else
+	typedef ft::factor_growth<2, 1>	Double;
+	typedef ft::factor_growth<3, 2>	Half;
+	typedef ft::page_growth<4096>	Page;
+	const size_t					max = static_cast<size_t>(-1) / sizeof(int);
+
+	print_growth<GrowthDouble>("2x", 5000);
+	print_growth<GrowthHalf>("1.5x", 5000);
+	print_growth<GrowthPage>("4 KiB pages", 5000);
+	print_growth<GrowthPageRgb>("4 KiB pages, 12 byte elements", 5000);
+	LOG("2x clamped: " << Double::grow(60, 61, 100, sizeof(int)));
+	LOG("1.5x clamped: " << Half::grow(90, 91, 100, sizeof(int)));
+	LOG("4 KiB pages clamped: " << Page::grow(1000, 1001, 1500, sizeof(int)));
+	LOG(SPEC(Page::grow(max - 10, max - 9, max, sizeof(int)) == max) << "4 KiB pages at max_size");
+#endif
+	LOG("");
+}
+
+// resize in std: new scalars are written before being read, so both print the same
+template <typename V>
+void	resize_default_init( V & v, size_t n ) {
+#if defined(STL)
+	v.resize(n);
+#else
+	v.resize_default_init(n);
+#endif
+}
+
+void	vector_test_resize_default_init( void ) {
+	CASE("Resize - default init");
+
+	ft::vector<int>	v(10, 7);
+
+	resize_default_init(v, 4);
+	LOG("Size: " << v.size() << ", back: " << v.back());
+	resize_default_init(v, 300);
+	for (size_t i = 4; i < v.size(); i++) {
+		v[i] = static_cast<int>(i * i);
+	}
+	long	sum = 0;
+	for (size_t i = 0; i < v.size(); i++) {
+		sum += v[i];
+	}
+	LOG("Size: " << v.size() << ", sum: " << sum);
+
+	Vector_t	words[4] = {"foo", "bar", "bazz", "buzz"};
+	Vector		w(words, words + 4);
+
+	resize_default_init(w, 2);
+	resize_default_init(w, 6);
+	bool	empty = true;
+	for (size_t i = 2; i < w.size(); i++) {
+		empty = empty && w[i].empty();
+	}
+	LOG(SPEC(empty) << "new strings are value initialized");
+	w[5] = "last";
+	print_vector(w);
+	print_metrics_vector(w);
+	LOG("");
+}
+
+// std stand-ins: a copy has exactly size() capacity, and SMALL_N stands for inline
+template <typename T>
+void	small_reserve_exact( T & v, size_t n ) {
+#if defined(STL)
+	if (n > v.capacity()) {
+		v.reserve(n);
+	} else {
+		T(v).swap(v);
+		v.reserve(n > SMALL_N ? n : SMALL_N);
+	}
+#else
+	v.reserve_exact(n);
+#endif
+}
+
+template <typename T>
+void	small_release( T & v ) {
+#if defined(STL)
+	T().swap(v);
+	v.reserve(SMALL_N);
+#else
+	v.release();
+#endif
+}
+
+void	vector_test_small_exact( void ) {
+	CASE("small_vector - reserve_exact, release and resize_default_init");
+
+	Vector_t	words[4] = {"a", "b", "c", "d"};
+	SmallVector	v(words, words + 3);
+
+	small_reserve_exact(v, 10);
+	print_small(v);
+	LOG("Capacity: " << v.capacity());
+	resize_default_init(v, 6);
+	print_small(v);
+	LOG("Capacity: " << v.capacity());
+	small_reserve_exact(v, 2);
+	print_small(v);
+	LOG("Capacity: " << v.capacity());
+	resize_default_init(v, 1);
+	small_reserve_exact(v, 3);
+	print_small(v);
+	LOG("Capacity: " << v.capacity());
+	v.resize(8, "z");
+	small_release(v);
+	print_small(v);
+	LOG("Capacity: " << v.capacity());
+	LOG("");
+}
+
 void	vector_tests( void ) {
 	LOG("");
 	LOG(COLOR_LPURPLE("➤ Vector Tests"));
@@ -619,6 +1321,7 @@ void	vector_tests( void ) {
     vector_test_constructor();
     vector_test_constructor_copy();
     vector_test_constructor_range();
+    vector_test_constructor_range_input();
     vector_test_constructor_fill();
     vector_test_iterator();
     vector_test_riterator();
@@ -627,6 +1330,8 @@ void	vector_tests( void ) {
     vector_test_max_size();
     vector_test_resize();
     vector_test_reserve();
+    vector_test_reserve_reallocate();
+    vector_test_shrink_to_fit();
     vector_test_at();
     vector_test_index_operator();
     vector_test_front();
@@ -634,6 +1339,7 @@ void	vector_tests( void ) {
     vector_test_data();
     vector_test_erase_fill();
     vector_test_erase_range();
+    vector_test_erase_if();
     vector_test_pop_back();
     vector_test_push_back();
     vector_test_swap();
@@ -647,4 +1353,15 @@ void	vector_tests( void ) {
     vector_test_equality();
     vector_test_inequality();
     vector_test_inequality_comparisons();
+	vector_test_soa_modifiers();
+	vector_test_soa_sort();
+	vector_test_bool_modifiers();
+	vector_test_bool_bit_operations();
+	vector_test_small_boundary();
+	vector_test_small_swap_copy();
+	vector_test_mapped();
+	vector_test_aligned();
+	vector_test_growth();
+	vector_test_resize_default_init();
+	vector_test_small_exact();
 }